@@ -0,0 +1,152 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include "../core/thread_pool.h"
+#include "../core/workspace.h"
+#include "../types/matrix.h"
+#include "../types/matrix_view.h"
+#include "qr_decomposition.h"
+#include "svd.h"
+
+namespace linalg {
+
+// Contiguous storage for a batch of equally sized matrices, laid out
+// back-to-back so the whole batch is one allocation and walks linearly
+// through memory. Individual matrices are exposed as zero-copy views.
+template <typename T>
+class MatrixBatch {
+public:
+    MatrixBatch(std::size_t count, std::size_t rows, std::size_t cols)
+        : count_(count),
+          rows_(rows),
+          cols_(cols),
+          data_(count * rows * cols, T{}) {}
+
+    std::size_t Size() const {
+        return count_;
+    }
+
+    std::size_t Rows() const {
+        return rows_;
+    }
+
+    std::size_t Cols() const {
+        return cols_;
+    }
+
+    MatrixView<T> operator[](std::size_t index) {
+        assert(index < count_);
+        return MatrixView<T>(data_.data() + index * rows_ * cols_, rows_,
+                             cols_, cols_);
+    }
+
+    ConstMatrixView<T> operator[](std::size_t index) const {
+        assert(index < count_);
+        return ConstMatrixView<T>(data_.data() + index * rows_ * cols_,
+                                  rows_, cols_, cols_);
+    }
+
+    T* Data() {
+        return data_.data();
+    }
+
+    const T* Data() const {
+        return data_.data();
+    }
+
+private:
+    std::size_t count_;
+    std::size_t rows_;
+    std::size_t cols_;
+    std::vector<T> data_;
+};
+
+namespace detail {
+
+inline constexpr std::size_t kBatchGrain = 16;
+
+// Shared skeleton for the batched drivers: the batch index range is split
+// over the pool, and each chunk keeps one decomposition object, one
+// workspace, and one input buffer alive for its whole run, so the per-matrix
+// fixed costs (allocation, arena warm-up, dispatch) are paid once per chunk
+// instead of once per matrix.
+template <typename Decomposition, typename T, typename LoadFn,
+          typename StoreFn>
+void BatchedApply(std::size_t count, LoadFn load, StoreFn store) {
+    ThreadPool::Global().ParallelFor(
+        0, count, kBatchGrain,
+        [&](std::size_t begin, std::size_t end) {
+            Decomposition decomposition;
+            Workspace workspace;
+            Matrix<T> input;
+            for (std::size_t i = begin; i < end; ++i) {
+                load(i, input);
+                decomposition.Compute(input, &workspace);
+                store(i, decomposition);
+            }
+        });
+}
+
+}  // namespace detail
+
+// Decomposes every matrix in the span in one call, processing independent
+// matrices in parallel across the global pool.
+template <typename T>
+std::vector<SVDResult<T>> BatchedSVD(std::span<const Matrix<T>> matrices) {
+    std::vector<SVDResult<T>> results(matrices.size());
+    detail::BatchedApply<SVDDecomposition<T>, T>(
+        matrices.size(),
+        [&](std::size_t i, Matrix<T>& input) { input = matrices[i]; },
+        [&](std::size_t i, const SVDDecomposition<T>& svd) {
+            results[i].u = svd.U();
+            results[i].singular_values = svd.SingularValues();
+            results[i].v = svd.V();
+        });
+    return results;
+}
+
+template <typename T>
+std::vector<SVDResult<T>> BatchedSVD(const MatrixBatch<T>& batch) {
+    std::vector<SVDResult<T>> results(batch.Size());
+    detail::BatchedApply<SVDDecomposition<T>, T>(
+        batch.Size(),
+        [&](std::size_t i, Matrix<T>& input) { input = batch[i]; },
+        [&](std::size_t i, const SVDDecomposition<T>& svd) {
+            results[i].u = svd.U();
+            results[i].singular_values = svd.SingularValues();
+            results[i].v = svd.V();
+        });
+    return results;
+}
+
+template <typename T>
+std::vector<QRResult<T>> BatchedQR(std::span<const Matrix<T>> matrices) {
+    std::vector<QRResult<T>> results(matrices.size());
+    detail::BatchedApply<QRDecomposition<T>, T>(
+        matrices.size(),
+        [&](std::size_t i, Matrix<T>& input) { input = matrices[i]; },
+        [&](std::size_t i, const QRDecomposition<T>& qr) {
+            results[i].q = qr.Q();
+            results[i].r = qr.R();
+        });
+    return results;
+}
+
+template <typename T>
+std::vector<QRResult<T>> BatchedQR(const MatrixBatch<T>& batch) {
+    std::vector<QRResult<T>> results(batch.Size());
+    detail::BatchedApply<QRDecomposition<T>, T>(
+        batch.Size(),
+        [&](std::size_t i, Matrix<T>& input) { input = batch[i]; },
+        [&](std::size_t i, const QRDecomposition<T>& qr) {
+            results[i].q = qr.Q();
+            results[i].r = qr.R();
+        });
+    return results;
+}
+
+}  // namespace linalg
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include "../types/matrix.h"
+#include "householder.h"
+
+namespace linalg {
+
+// Golub-Kahan bidiagonalization: A = U * B * V^T with U, V orthogonal and B
+// upper bidiagonal. Alternates left reflectors (columns) and right reflectors
+// (rows); the trailing updates on B and the accumulations into U and V are
+// threaded the same way as in QR, with scratch drawn from the workspace when
+// one is supplied.
+template <typename T>
+void Bidiagonalize(const Matrix<T>& a, Matrix<T>& u, Matrix<T>& b,
+                   Matrix<T>& v, Workspace* workspace = nullptr) {
+    std::size_t m = a.Rows();
+    std::size_t n = a.Cols();
+    b = a;
+    u.SetIdentity(m);
+    v.SetIdentity(n);
+
+    Householder<T> left;
+    Householder<T> right;
+    std::size_t steps = std::min(m, n);
+    for (std::size_t k = 0; k < steps; ++k) {
+        ComputeHouseholderInto(left, &b(k, k), m - k, n);
+        b(k, k) = left.beta;
+        for (std::size_t i = k + 1; i < m; ++i) {
+            b(i, k) = T{};
+        }
+        ApplyHouseholderLeftThreaded(b, left, k, k + 1, workspace);
+        ApplyHouseholderRightThreaded(u, left, 0, k);
+
+        if (k + 2 < n) {
+            ComputeHouseholderInto(right, &b(k, k + 1), n - k - 1);
+            b(k, k + 1) = right.beta;
+            for (std::size_t j = k + 2; j < n; ++j) {
+                b(k, j) = T{};
+            }
+            ApplyHouseholderRightThreaded(b, right, k + 1, k + 1);
+            ApplyHouseholderRightThreaded(v, right, 0, k + 1);
+        }
+    }
+}
+
+// Values-only variant: reduces A to the bidiagonal band without accumulating
+// U or V, for drivers that only need the singular values. Skipping the
+// accumulators removes the dominant share of the reduction's work.
+template <typename T>
+void Bidiagonalize(const Matrix<T>& a, Matrix<T>& b,
+                   Workspace* workspace = nullptr) {
+    std::size_t m = a.Rows();
+    std::size_t n = a.Cols();
+    b = a;
+
+    Householder<T> left;
+    Householder<T> right;
+    std::size_t steps = std::min(m, n);
+    for (std::size_t k = 0; k < steps; ++k) {
+        ComputeHouseholderInto(left, &b(k, k), m - k, n);
+        b(k, k) = left.beta;
+        for (std::size_t i = k + 1; i < m; ++i) {
+            b(i, k) = T{};
+        }
+        ApplyHouseholderLeftThreaded(b, left, k, k + 1, workspace);
+
+        if (k + 2 < n) {
+            ComputeHouseholderInto(right, &b(k, k + 1), n - k - 1);
+            b(k, k + 1) = right.beta;
+            for (std::size_t j = k + 2; j < n; ++j) {
+                b(k, j) = T{};
+            }
+            ApplyHouseholderRightThreaded(b, right, k + 1, k + 1);
+        }
+    }
+}
+
+}  // namespace linalg
@@ -0,0 +1,148 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "../core/simd.h"
+#include "../types/matrix.h"
+
+namespace linalg {
+
+namespace detail {
+
+// Right-hand-side column panel width for the substitution sweeps: wide
+// enough that each axpy pays for its row fetch, narrow enough that the
+// active panel of hundreds-of-RHS solves stays cache-resident.
+inline constexpr std::size_t kSolvePanelCols = 32;
+
+}  // namespace detail
+
+// Persistent LU factorization with partial pivoting: P * A = L * U, stored
+// packed (unit-diagonal L below, U on and above the diagonal). Factor once
+// at O(n^3), then Solve/SolveMany/Det/Inverse all reuse the triangles —
+// each extra right-hand side costs O(n^2), not a refactorization.
+template <typename T>
+class Factorization {
+public:
+    void Compute(Matrix<T> a) {
+        assert(a.Rows() == a.Cols());
+        lu_ = std::move(a);
+        std::size_t n = lu_.Rows();
+        pivots_.resize(n);
+        pivot_sign_ = T{1};
+        singular_ = false;
+
+        for (std::size_t k = 0; k < n; ++k) {
+            std::size_t pivot = k;
+            for (std::size_t i = k + 1; i < n; ++i) {
+                if (std::abs(lu_(i, k)) > std::abs(lu_(pivot, k))) {
+                    pivot = i;
+                }
+            }
+            pivots_[k] = pivot;
+            if (pivot != k) {
+                for (std::size_t j = 0; j < n; ++j) {
+                    std::swap(lu_(k, j), lu_(pivot, j));
+                }
+                pivot_sign_ = -pivot_sign_;
+            }
+            if (lu_(k, k) == T{}) {
+                singular_ = true;
+                continue;
+            }
+            for (std::size_t i = k + 1; i < n; ++i) {
+                T factor = lu_(i, k) / lu_(k, k);
+                lu_(i, k) = factor;
+                simd::Axpy(-factor, &lu_(k, k + 1), &lu_(i, k + 1),
+                           n - k - 1);
+            }
+        }
+    }
+
+    // An exactly zero pivot was hit; Solve/Inverse must not be called.
+    bool Singular() const {
+        return singular_;
+    }
+
+    // Solves A x = b for a single right-hand side column.
+    Matrix<T> Solve(const Matrix<T>& b) const {
+        assert(b.Cols() == 1);
+        return SolveMany(b);
+    }
+
+    // Solves A X = B for all columns of B at once. The substitution runs
+    // over column panels: within a panel every row update is one
+    // unit-stride axpy against a row of the factors, so the triangles are
+    // streamed once per panel instead of once per right-hand side.
+    Matrix<T> SolveMany(const Matrix<T>& b) const {
+        assert(!singular_ && b.Rows() == lu_.Rows());
+        std::size_t n = lu_.Rows();
+        std::size_t k = b.Cols();
+        Matrix<T> x = b;
+        for (std::size_t i = 0; i < n; ++i) {
+            if (pivots_[i] != i) {
+                for (std::size_t j = 0; j < k; ++j) {
+                    std::swap(x(i, j), x(pivots_[i], j));
+                }
+            }
+        }
+
+        for (std::size_t col = 0; col < k;
+             col += detail::kSolvePanelCols) {
+            std::size_t width =
+                std::min(detail::kSolvePanelCols, k - col);
+            // Forward substitution with unit-diagonal L.
+            for (std::size_t i = 1; i < n; ++i) {
+                for (std::size_t j = 0; j < i; ++j) {
+                    simd::Axpy(-lu_(i, j), &x(j, col), &x(i, col), width);
+                }
+            }
+            // Back substitution with U.
+            for (std::size_t i = n; i-- > 0;) {
+                for (std::size_t j = i + 1; j < n; ++j) {
+                    simd::Axpy(-lu_(i, j), &x(j, col), &x(i, col), width);
+                }
+                T inv = T{1} / lu_(i, i);
+                for (std::size_t j = 0; j < width; ++j) {
+                    x(i, col + j) *= inv;
+                }
+            }
+        }
+        return x;
+    }
+
+    // det(A) = sign(P) * prod(diag(U)); zero when a pivot vanished.
+    T Det() const {
+        if (singular_) {
+            return T{};
+        }
+        T det = pivot_sign_;
+        for (std::size_t i = 0; i < lu_.Rows(); ++i) {
+            det *= lu_(i, i);
+        }
+        return det;
+    }
+
+    // A^{-1} as the multi-RHS solve against the identity. Prefer solving
+    // against the factors directly when the inverse itself is not needed.
+    Matrix<T> Inverse() const {
+        assert(!singular_);
+        return SolveMany(Matrix<T>::Identity(lu_.Rows()));
+    }
+
+    const Matrix<T>& PackedLU() const {
+        return lu_;
+    }
+
+private:
+    Matrix<T> lu_;
+    std::vector<std::size_t> pivots_;
+    T pivot_sign_ = T{1};
+    bool singular_ = false;
+};
+
+}  // namespace linalg
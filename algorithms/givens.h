@@ -0,0 +1,132 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include "../core/thread_pool.h"
+#include "../types/matrix.h"
+
+namespace linalg {
+
+// Plane rotation [c s; -s c] chosen so that it maps (a, b) onto (r, 0).
+template <typename T>
+struct GivensRotation {
+    T c = T{1};
+    T s = T{};
+    T r = T{};
+};
+
+template <typename T>
+GivensRotation<T> ComputeGivens(T a, T b) {
+    GivensRotation<T> result;
+    if (b == T{}) {
+        result.c = T{1};
+        result.s = T{};
+        result.r = a;
+        return result;
+    }
+    T hypot = std::hypot(a, b);
+    result.c = a / hypot;
+    result.s = b / hypot;
+    result.r = hypot;
+    return result;
+}
+
+// Rows row1 and row2 of A over [col_begin, col_end) are replaced by their
+// rotation: row1 <- c*row1 + s*row2, row2 <- -s*row1 + c*row2.
+template <typename MatrixT, typename T>
+void ApplyGivensLeft(MatrixT& a, T c, T s, std::size_t row1,
+                     std::size_t row2, std::size_t col_begin,
+                     std::size_t col_end) {
+    for (std::size_t j = col_begin; j < col_end; ++j) {
+        T x = a(row1, j);
+        T y = a(row2, j);
+        a(row1, j) = c * x + s * y;
+        a(row2, j) = -s * x + c * y;
+    }
+}
+
+template <typename MatrixT, typename T>
+void ApplyGivensLeft(MatrixT& a, T c, T s, std::size_t row1,
+                     std::size_t row2) {
+    ApplyGivensLeft(a, c, s, row1, row2, std::size_t{0}, a.Cols());
+}
+
+// Columns col1 and col2 of A over [row_begin, row_end) are replaced by their
+// rotation: col1 <- c*col1 + s*col2, col2 <- -s*col1 + c*col2.
+template <typename MatrixT, typename T>
+void ApplyGivensRight(MatrixT& a, T c, T s, std::size_t col1,
+                      std::size_t col2, std::size_t row_begin,
+                      std::size_t row_end) {
+    for (std::size_t i = row_begin; i < row_end; ++i) {
+        T x = a(i, col1);
+        T y = a(i, col2);
+        a(i, col1) = c * x + s * y;
+        a(i, col2) = -s * x + c * y;
+    }
+}
+
+template <typename MatrixT, typename T>
+void ApplyGivensRight(MatrixT& a, T c, T s, std::size_t col1,
+                      std::size_t col2) {
+    ApplyGivensRight(a, c, s, col1, col2, std::size_t{0}, a.Rows());
+}
+
+// A wave of rotations acting on consecutive column pairs: rotation i mixes
+// columns (first_col + i, first_col + i + 1). The bulge-chasing SVD sweep
+// produces exactly this pattern, one wave per implicit QR step.
+template <typename T>
+struct GivensWave {
+    std::size_t first_col = 0;
+    std::vector<GivensRotation<T>> rotations;
+
+    void Reset(std::size_t first) {
+        first_col = first;
+        rotations.clear();
+    }
+
+    void Append(const GivensRotation<T>& rotation) {
+        rotations.push_back(rotation);
+    }
+};
+
+namespace detail {
+
+inline constexpr std::size_t kGivensWaveGrain = 32;
+
+}  // namespace detail
+
+// Applies the whole wave from the right in a single pass: the outer loop
+// walks rows, the inner loop runs every rotation over that row while it is
+// cache-resident, so each row of the accumulation matrix is read and written
+// once per sweep instead of once per rotation. Rows are independent, so the
+// pass is split over the global pool for tall accumulators.
+template <typename MatrixT, typename T>
+void ApplyGivensWaveRight(MatrixT& a, const GivensWave<T>& wave) {
+    if (wave.rotations.empty()) {
+        return;
+    }
+    auto apply_rows = [&](std::size_t row_begin, std::size_t row_end) {
+        for (std::size_t i = row_begin; i < row_end; ++i) {
+            for (std::size_t r = 0; r < wave.rotations.size(); ++r) {
+                const GivensRotation<T>& g = wave.rotations[r];
+                std::size_t col = wave.first_col + r;
+                T x = a(i, col);
+                T y = a(i, col + 1);
+                a(i, col) = g.c * x + g.s * y;
+                a(i, col + 1) = -g.s * x + g.c * y;
+            }
+        }
+    };
+
+    std::size_t work = a.Rows() * wave.rotations.size();
+    if (work < detail::kGivensWaveGrain * detail::kGivensWaveGrain) {
+        apply_rows(0, a.Rows());
+        return;
+    }
+    ThreadPool::Global().ParallelFor(0, a.Rows(), detail::kGivensWaveGrain,
+                                     apply_rows);
+}
+
+}  // namespace linalg
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+
+#include "../types/banded_matrix.h"
+#include "../types/matrix.h"
+#include "householder.h"
+
+namespace linalg {
+
+// Householder similarity reduction to upper Hessenberg form: A = Q * H * Q^T
+// with Q orthogonal and H zero below the first subdiagonal. Reducing once
+// costs O(n^3); every subsequent QR sweep on H is O(n^2) instead of O(n^3),
+// which is what makes the shifted eigenvalue iteration viable on dense input.
+template <typename T>
+void HessenbergReduce(const Matrix<T>& a, Matrix<T>& q, Matrix<T>& h,
+                      Workspace* workspace = nullptr) {
+    assert(a.Rows() == a.Cols());
+    std::size_t n = a.Rows();
+    h = a;
+    q.SetIdentity(n);
+    if (n < 3) {
+        return;
+    }
+
+    Householder<T> reflector;
+    for (std::size_t k = 0; k + 2 < n; ++k) {
+        ComputeHouseholderInto(reflector, &h(k + 1, k), n - k - 1, n);
+
+        h(k + 1, k) = reflector.beta;
+        for (std::size_t i = k + 2; i < n; ++i) {
+            h(i, k) = T{};
+        }
+        // Similarity transform: H <- P H P with P acting on rows/columns
+        // k+1 and below.
+        ApplyHouseholderLeftThreaded(h, reflector, k + 1, k + 1, workspace);
+        ApplyHouseholderRightThreaded(h, reflector, 0, k + 1);
+        ApplyHouseholderRightThreaded(q, reflector, 0, k + 1);
+    }
+}
+
+// Symmetric specialization: for symmetric A the Hessenberg form is
+// tridiagonal up to roundoff; the off-band residue is cleaned and the band
+// symmetrized so downstream code can rely on exact structure.
+template <typename T>
+void TridiagonalReduce(const Matrix<T>& a, Matrix<T>& q, Matrix<T>& t,
+                       Workspace* workspace = nullptr) {
+    HessenbergReduce(a, q, t, workspace);
+    std::size_t n = t.Rows();
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = i + 2; j < n; ++j) {
+            t(i, j) = T{};
+            t(j, i) = T{};
+        }
+    }
+    for (std::size_t i = 0; i + 1 < n; ++i) {
+        T band = (t(i, i + 1) + t(i + 1, i)) / T{2};
+        t(i, i + 1) = band;
+        t(i + 1, i) = band;
+    }
+}
+
+// Banded-output variant: the reduction itself needs a dense working matrix
+// (the intermediate stages are full), but what leaves the routine is just
+// the symmetrized tridiagonal band in O(n) storage.
+template <typename T>
+void TridiagonalReduce(const Matrix<T>& a, Matrix<T>& q, BandedMatrix<T>& t,
+                       Workspace* workspace = nullptr) {
+    Matrix<T> work;
+    HessenbergReduce(a, q, work, workspace);
+    std::size_t n = work.Rows();
+    t = BandedMatrix<T>(n, 1, 1);
+    for (std::size_t i = 0; i < n; ++i) {
+        t.At(i, i) = work(i, i);
+    }
+    for (std::size_t i = 0; i + 1 < n; ++i) {
+        T band = (work(i, i + 1) + work(i + 1, i)) / T{2};
+        t.At(i, i + 1) = band;
+        t.At(i + 1, i) = band;
+    }
+}
+
+}  // namespace linalg
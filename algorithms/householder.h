@@ -0,0 +1,266 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include "../core/simd.h"
+#include "../core/thread_pool.h"
+#include "../core/workspace.h"
+#include "../types/matrix.h"
+
+namespace linalg {
+
+// Elementary reflector H = I - tau * v * v^T with v[0] fixed to 1, stored in
+// the compact form the drivers pass around. beta is the value the pivot
+// element takes after H is applied to the vector the reflector was built from.
+template <typename T>
+struct Householder {
+    std::vector<T> v;
+    T tau = T{};
+    T beta = T{};
+};
+
+namespace detail {
+
+// Normalizes result.v (already filled with the source vector) into the
+// reflector that maps it onto beta * e1, choosing the sign of beta to avoid
+// cancellation in v[0].
+template <typename T>
+void FinishHouseholder(Householder<T>& result) {
+    std::size_t n = result.v.size();
+    if (n == 0) {
+        return;
+    }
+
+    T norm_tail{};
+    for (std::size_t i = 1; i < n; ++i) {
+        norm_tail += result.v[i] * result.v[i];
+    }
+    T alpha = result.v[0];
+    if (norm_tail == T{}) {
+        result.v[0] = T{1};
+        result.beta = alpha;
+        return;
+    }
+
+    T norm = std::sqrt(alpha * alpha + norm_tail);
+    T beta = (alpha >= T{}) ? -norm : norm;
+    T v0 = alpha - beta;
+    for (std::size_t i = 1; i < n; ++i) {
+        result.v[i] /= v0;
+    }
+    result.v[0] = T{1};
+    result.tau = T{2} * v0 * v0 / (norm_tail + v0 * v0);
+    result.beta = beta;
+}
+
+}  // namespace detail
+
+// Rebuilds the reflector in place, reading x[0], x[stride], ... — a stride
+// lets a column of a row-major matrix (or view) be reflected without
+// extraction. Reusing one Householder object across a factorization loop
+// keeps v's capacity warm, so steady-state iterations allocate nothing.
+template <typename T>
+void ComputeHouseholderInto(Householder<T>& result, const T* x,
+                            std::size_t n, std::size_t stride = 1) {
+    result.v.resize(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        result.v[i] = x[i * stride];
+    }
+    result.tau = T{};
+    result.beta = T{};
+    detail::FinishHouseholder(result);
+}
+
+// Builds the reflector for the contiguous vector x of length n.
+template <typename T>
+Householder<T> ComputeHouseholder(const T* x, std::size_t n) {
+    Householder<T> result;
+    ComputeHouseholderInto(result, x, n);
+    return result;
+}
+
+// Strided variant of the above.
+template <typename T>
+Householder<T> ComputeHouseholder(const T* x, std::size_t n,
+                                  std::size_t stride) {
+    Householder<T> result;
+    ComputeHouseholderInto(result, x, n, stride);
+    return result;
+}
+
+// A(row_begin.., col_begin..col_end) = H * A(row_begin.., col_begin..col_end),
+// i.e. the rank-1 update A -= tau * v * (v^T * A) restricted to a column
+// range. The loop order follows the storage layout: row-major walks rows of
+// A with unit stride through the scratch vector; column-major processes one
+// contiguous column at a time (dot then axpy) and needs no scratch at all.
+// The explicit column range lets callers split one update across threads.
+template <typename MatrixT, typename T>
+void ApplyHouseholderLeft(MatrixT& a, const Householder<T>& h,
+                          std::size_t row_begin, std::size_t col_begin,
+                          std::size_t col_end, T* scratch) {
+    std::size_t m = h.v.size();
+    if (m == 0 || col_begin >= col_end || h.tau == T{}) {
+        return;
+    }
+
+    if constexpr (linalg::detail::IsColumnMajor<MatrixT>()) {
+        (void)scratch;
+        for (std::size_t j = col_begin; j < col_end; ++j) {
+            T* column = &a(row_begin, j);
+            T w = simd::Dot(column, h.v.data(), m);
+            simd::Axpy(-h.tau * w, h.v.data(), column, m);
+        }
+    } else {
+        std::size_t n = col_end - col_begin;
+        std::fill(scratch, scratch + n, T{});
+        for (std::size_t i = 0; i < m; ++i) {
+            simd::Axpy(h.v[i], &a(row_begin + i, col_begin), scratch, n);
+        }
+        for (std::size_t i = 0; i < m; ++i) {
+            simd::Axpy(-h.tau * h.v[i], scratch,
+                       &a(row_begin + i, col_begin), n);
+        }
+    }
+}
+
+template <typename MatrixT, typename T>
+void ApplyHouseholderLeft(MatrixT& a, const Householder<T>& h,
+                          std::size_t row_begin, std::size_t col_begin,
+                          std::size_t col_end) {
+    if (col_begin >= col_end) {
+        return;
+    }
+    if constexpr (linalg::detail::IsColumnMajor<MatrixT>()) {
+        ApplyHouseholderLeft(a, h, row_begin, col_begin, col_end,
+                             static_cast<T*>(nullptr));
+    } else {
+        std::vector<T> w(col_end - col_begin);
+        ApplyHouseholderLeft(a, h, row_begin, col_begin, col_end, w.data());
+    }
+}
+
+template <typename MatrixT, typename T>
+void ApplyHouseholderLeft(MatrixT& a, const Householder<T>& h,
+                          std::size_t row_begin, std::size_t col_begin) {
+    ApplyHouseholderLeft(a, h, row_begin, col_begin, a.Cols());
+}
+
+// A(row_begin..row_end, col_begin..) = A(row_begin..row_end, col_begin..) * H,
+// i.e. A -= tau * (A * v) * v^T over a row range. Row-major runs a
+// unit-stride dot and axpy per row; column-major accumulates w = A * v as a
+// column-axpy sweep and applies the rank-1 update column by column, so the
+// inner loops stay unit-stride in either layout.
+template <typename MatrixT, typename T>
+void ApplyHouseholderRight(MatrixT& a, const Householder<T>& h,
+                           std::size_t row_begin, std::size_t row_end,
+                           std::size_t col_begin) {
+    std::size_t n = h.v.size();
+    if (n == 0 || row_begin >= row_end || h.tau == T{}) {
+        return;
+    }
+
+    if constexpr (linalg::detail::IsColumnMajor<MatrixT>()) {
+        std::size_t rows = row_end - row_begin;
+        std::vector<T> w(rows, T{});
+        for (std::size_t j = 0; j < n; ++j) {
+            simd::Axpy(h.v[j], &a(row_begin, col_begin + j), w.data(),
+                       rows);
+        }
+        for (std::size_t j = 0; j < n; ++j) {
+            simd::Axpy(-h.tau * h.v[j], w.data(),
+                       &a(row_begin, col_begin + j), rows);
+        }
+    } else {
+        for (std::size_t i = row_begin; i < row_end; ++i) {
+            T* row = &a(i, col_begin);
+            T w = simd::Dot(row, h.v.data(), n);
+            simd::Axpy(-h.tau * w, h.v.data(), row, n);
+        }
+    }
+}
+
+template <typename MatrixT, typename T>
+void ApplyHouseholderRight(MatrixT& a, const Householder<T>& h,
+                           std::size_t row_begin, std::size_t col_begin) {
+    ApplyHouseholderRight(a, h, row_begin, a.Rows(), col_begin);
+}
+
+namespace detail {
+
+// Trailing updates narrower than this run single-threaded: below it the
+// per-chunk dispatch costs more than the arithmetic it distributes.
+inline constexpr std::size_t kParallelReflectorWork = 64 * 1024;
+inline constexpr std::size_t kParallelGrain = 64;
+
+}  // namespace detail
+
+// Threaded variants of the reflector updates: the column (resp. row) range is
+// split over the global pool when the update is large enough to amortize the
+// dispatch, and runs inline otherwise. When a workspace is supplied the
+// left-apply scratch vector comes from the arena (one slice per chunk)
+// instead of the heap.
+template <typename MatrixT, typename T>
+void ApplyHouseholderLeftThreaded(MatrixT& a, const Householder<T>& h,
+                                  std::size_t row_begin,
+                                  std::size_t col_begin,
+                                  Workspace* workspace = nullptr) {
+    std::size_t cols = a.Cols();
+    if (col_begin >= cols) {
+        return;
+    }
+
+    Workspace::Marker marker;
+    T* scratch = nullptr;
+    if (workspace != nullptr &&
+        !linalg::detail::IsColumnMajor<MatrixT>()) {
+        marker = workspace->Mark();
+        scratch = workspace->Allocate<T>(cols - col_begin);
+    }
+
+    std::size_t work = h.v.size() * (cols - col_begin);
+    if (work < detail::kParallelReflectorWork) {
+        if (scratch != nullptr) {
+            ApplyHouseholderLeft(a, h, row_begin, col_begin, cols, scratch);
+        } else {
+            ApplyHouseholderLeft(a, h, row_begin, col_begin);
+        }
+    } else {
+        ThreadPool::Global().ParallelFor(
+            col_begin, cols, detail::kParallelGrain,
+            [&](std::size_t chunk_begin, std::size_t chunk_end) {
+                if (scratch != nullptr) {
+                    ApplyHouseholderLeft(a, h, row_begin, chunk_begin,
+                                         chunk_end,
+                                         scratch + (chunk_begin - col_begin));
+                } else {
+                    ApplyHouseholderLeft(a, h, row_begin, chunk_begin,
+                                         chunk_end);
+                }
+            });
+    }
+
+    if (scratch != nullptr) {
+        workspace->Rewind(marker);
+    }
+}
+
+template <typename MatrixT, typename T>
+void ApplyHouseholderRightThreaded(MatrixT& a, const Householder<T>& h,
+                                   std::size_t row_begin,
+                                   std::size_t col_begin) {
+    std::size_t work = h.v.size() * (a.Rows() - row_begin);
+    if (work < detail::kParallelReflectorWork) {
+        ApplyHouseholderRight(a, h, row_begin, col_begin);
+        return;
+    }
+    ThreadPool::Global().ParallelFor(
+        row_begin, a.Rows(), detail::kParallelGrain,
+        [&](std::size_t chunk_begin, std::size_t chunk_end) {
+            ApplyHouseholderRight(a, h, chunk_begin, chunk_end, col_begin);
+        });
+}
+
+}  // namespace linalg
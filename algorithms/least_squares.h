@@ -0,0 +1,121 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <utility>
+
+#include "../types/matrix.h"
+#include "../types/triangular_matrix.h"
+#include "householder.h"
+#include "qr_decomposition.h"
+
+namespace linalg {
+
+namespace detail {
+
+// Row-panel height for the blocked least-squares reduction. Each panel is
+// stacked under the carried n x n triangle and refactored, so the panel
+// should dwarf the triangle to amortize the restack — but stay small
+// enough that [R; panel] is cache-resident for the reflector sweeps.
+inline std::size_t LeastSquaresPanelRows(std::size_t n) {
+    return std::max<std::size_t>(4 * n, 256);
+}
+
+}  // namespace detail
+
+// Economy-size QR for tall operands: Q is m x n and R is n x n, produced
+// from the compact factorization without the full m x m orthogonal factor
+// ever existing. This is the API to reach for when m >> n.
+template <typename T>
+QRResult<T> ThinQR(const Matrix<T>& a, Workspace* workspace = nullptr) {
+    assert(a.Rows() >= a.Cols());
+    std::size_t n = a.Cols();
+    QRDecomposition<T> qr;
+    qr.ComputeCompact(a, workspace);
+
+    QRResult<T> result;
+    result.q = qr.MaterializeThinQ();
+    result.r = Matrix<T>(n, n);
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = i; j < n; ++j) {
+            result.r(i, j) = qr.PackedFactors()(i, j);
+        }
+    }
+    return result;
+}
+
+// Minimizes ||A x - b|| for tall full-rank A (multi-column b allowed) by a
+// TSQR-style streaming reduction: row panels of [A | b] are stacked under
+// the carried [R | Q^T b] rows and reduced by Householder reflectors, so
+// peak residency is one panel plus the (n x (n + k)) carry and Q is never
+// formed. The trailing-column updates inside each panel run on the global
+// thread pool. For the 500k x 64 regression shape this is O(m n^2) work
+// and O(n^2 + panel) memory, against the O(m^2)-flavored cost of going
+// through the full orthogonal factor.
+template <typename T>
+Matrix<T> LeastSquaresSolve(const Matrix<T>& a, const Matrix<T>& b,
+                            Workspace* workspace = nullptr) {
+    assert(a.Rows() >= a.Cols() && a.Rows() == b.Rows());
+    std::size_t m = a.Rows();
+    std::size_t n = a.Cols();
+    std::size_t k = b.Cols();
+    std::size_t panel_rows = detail::LeastSquaresPanelRows(n);
+
+    Workspace local;
+    Workspace& ws = workspace != nullptr ? *workspace : local;
+
+    // carry holds [R | Q^T b] restricted to the leading n rows; it starts
+    // zero, which the first panel's reflectors simply pass through.
+    Matrix<T> carry(n, n + k);
+    Matrix<T> stacked;
+    Householder<T> reflector;
+
+    for (std::size_t row = 0; row < m; row += panel_rows) {
+        std::size_t rows = std::min(panel_rows, m - row);
+        stacked.Resize(n + rows, n + k);
+        for (std::size_t i = 0; i < n; ++i) {
+            for (std::size_t j = 0; j < n + k; ++j) {
+                stacked(i, j) = carry(i, j);
+            }
+        }
+        for (std::size_t i = 0; i < rows; ++i) {
+            for (std::size_t j = 0; j < n; ++j) {
+                stacked(n + i, j) = a(row + i, j);
+            }
+            for (std::size_t j = 0; j < k; ++j) {
+                stacked(n + i, n + j) = b(row + i, j);
+            }
+        }
+
+        // Reduce the first n columns; the right-hand-side columns only
+        // receive the reflectors, they never source one.
+        for (std::size_t c = 0; c < n; ++c) {
+            ComputeHouseholderInto(reflector, &stacked(c, c),
+                                   stacked.Rows() - c, n + k);
+            stacked(c, c) = reflector.beta;
+            ApplyHouseholderLeftThreaded(stacked, reflector, c, c + 1, &ws);
+        }
+
+        for (std::size_t i = 0; i < n; ++i) {
+            for (std::size_t j = 0; j < n + k; ++j) {
+                carry(i, j) = j >= i ? stacked(i, j) : T{};
+            }
+        }
+    }
+
+    // Back-substitute R x = Q^T b from the packed triangle.
+    TriangularMatrix<T> r(n, TriangularKind::kUpper);
+    Matrix<T> rhs(n, k);
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = i; j < n; ++j) {
+            r.At(i, j) = carry(i, j);
+        }
+        for (std::size_t j = 0; j < k; ++j) {
+            rhs(i, j) = carry(i, n + j);
+        }
+    }
+    return r.Solve(std::move(rhs));
+}
+
+}  // namespace linalg
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+
+#include "../types/matrix.h"
+#include "../types/triangular_matrix.h"
+#include "qr_decomposition.h"
+
+namespace linalg {
+
+namespace detail {
+
+template <typename To, typename From>
+Matrix<To> ConvertPrecision(const Matrix<From>& source) {
+    Matrix<To> result(source.Rows(), source.Cols());
+    const From* in = source.Data();
+    To* out = result.Data();
+    std::size_t count = source.Rows() * source.Cols();
+    for (std::size_t i = 0; i < count; ++i) {
+        out[i] = static_cast<To>(in[i]);
+    }
+    return result;
+}
+
+template <typename T>
+T MaxAbs(const Matrix<T>& m) {
+    T result = T{};
+    const T* data = m.Data();
+    std::size_t count = m.Rows() * m.Cols();
+    for (std::size_t i = 0; i < count; ++i) {
+        result = std::max(result, std::abs(data[i]));
+    }
+    return result;
+}
+
+}  // namespace detail
+
+// Mixed-precision solver for square systems A x = b: the O(n^3)
+// factorization runs entirely in float — twice the SIMD width and half the
+// memory traffic of a double factorization — and full double accuracy is
+// recovered by iterative refinement, whose residuals are computed in double
+// with the ordinary operator*. Each refinement step reuses the float
+// factors, so its cost is O(n^2); for well-conditioned systems two or three
+// steps reach working precision.
+template <typename T = double, typename FactorT = float>
+class MixedPrecisionSolver {
+public:
+    // Factors a float copy of A; the double original is kept for the
+    // residual products during refinement.
+    void Factor(const Matrix<T>& a, Workspace* workspace = nullptr) {
+        assert(a.Rows() == a.Cols());
+        a_ = a;
+        qr_.ComputeCompact(detail::ConvertPrecision<FactorT>(a), workspace);
+        q_ = qr_.MaterializeThinQ();
+        r_ = qr_.TriangularR();
+    }
+
+    // Solves for every column of b, refining until the residual stops
+    // improving or max_refinements corrections have been applied.
+    Matrix<T> Solve(const Matrix<T>& b,
+                    std::size_t max_refinements = 5) const {
+        assert(a_.Rows() == b.Rows());
+
+        // Initial solve in the factorization precision.
+        Matrix<T> x = detail::ConvertPrecision<T>(
+            CorrectionFor(detail::ConvertPrecision<FactorT>(b)));
+
+        // Refinement: the residual r = b - A x is formed in full precision;
+        // solving A d = r with the float factors then removes the leading
+        // error term of x.
+        const T tol = std::numeric_limits<T>::epsilon() * detail::MaxAbs(a_);
+        Matrix<T> residual = b - a_ * x;
+        for (std::size_t step = 0; step < max_refinements; ++step) {
+            if (detail::MaxAbs(residual) <=
+                tol * std::max(detail::MaxAbs(x), T{1})) {
+                break;
+            }
+            Matrix<T> correction = detail::ConvertPrecision<T>(CorrectionFor(
+                detail::ConvertPrecision<FactorT>(residual)));
+            x += correction;
+            residual = b - a_ * x;
+        }
+        return x;
+    }
+
+private:
+    // One O(n^2) solve against the float factors: R d = Q^T rhs.
+    Matrix<FactorT> CorrectionFor(const Matrix<FactorT>& rhs) const {
+        return r_.Solve(MultiplyAtB(q_, rhs));
+    }
+
+    Matrix<T> a_;
+    QRDecomposition<FactorT> qr_;
+    Matrix<FactorT> q_;
+    TriangularMatrix<FactorT> r_;
+};
+
+}  // namespace linalg
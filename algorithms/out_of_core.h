@@ -0,0 +1,81 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+
+#include "../types/matrix.h"
+#include "../types/streaming.h"
+#include "qr_decomposition.h"
+
+namespace linalg {
+
+// Out-of-core Gram accumulation G = A^T * A: each row panel contributes
+// P^T * P through the fused transposed multiply, so the full matrix is
+// touched exactly once, front to back, and peak residency is one panel plus
+// the n x n accumulator.
+template <typename T>
+Matrix<T> StreamedGram(const RowPanelReader<T>& reader) {
+    std::size_t n = reader.Cols();
+    Matrix<T> gram(n, n);
+    Matrix<T> panel;
+    for (std::size_t p = 0; p < reader.PanelCount(); ++p) {
+        panel = reader.Panel(p);
+        gram += MultiplyAtB(panel, panel);
+    }
+    return gram;
+}
+
+// Out-of-core tall-skinny QR: processes one row panel at a time, carrying
+// only the running n x n triangular factor. Each step stacks the current R
+// on top of the next panel and refactors; since QR of [R; P] has the same R
+// as QR of all rows seen so far, the final factor equals the R of the whole
+// matrix (up to row signs). Q is never formed — for the normal-equations
+// and least-squares pipelines the triangle is what gets consumed.
+template <typename T>
+Matrix<T> StreamedTallSkinnyQR(const RowPanelReader<T>& reader,
+                               Workspace* workspace = nullptr) {
+    std::size_t n = reader.Cols();
+    QRDecomposition<T> qr;
+    Matrix<T> r(0, n);
+    Matrix<T> stacked;
+
+    for (std::size_t p = 0; p < reader.PanelCount(); ++p) {
+        ConstMatrixView<T> panel = reader.Panel(p);
+        std::size_t carried = r.Rows();
+        stacked.Resize(carried + panel.Rows(), n);
+        for (std::size_t i = 0; i < carried; ++i) {
+            for (std::size_t j = i; j < n; ++j) {
+                stacked(i, j) = r(i, j);
+            }
+        }
+        for (std::size_t i = 0; i < panel.Rows(); ++i) {
+            for (std::size_t j = 0; j < n; ++j) {
+                stacked(carried + i, j) = panel(i, j);
+            }
+        }
+
+        qr.ComputeCompact(std::move(stacked), workspace);
+        std::size_t kept = std::min(qr.PackedFactors().Rows(), n);
+        r.Resize(kept, n);
+        for (std::size_t i = 0; i < kept; ++i) {
+            for (std::size_t j = i; j < n; ++j) {
+                r(i, j) = qr.PackedFactors()(i, j);
+            }
+        }
+    }
+
+    // Pad to a square triangle when the input had fewer rows than columns.
+    if (r.Rows() < n) {
+        Matrix<T> padded(n, n);
+        for (std::size_t i = 0; i < r.Rows(); ++i) {
+            for (std::size_t j = i; j < n; ++j) {
+                padded(i, j) = r(i, j);
+            }
+        }
+        r = std::move(padded);
+    }
+    return r;
+}
+
+}  // namespace linalg
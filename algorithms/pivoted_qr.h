@@ -0,0 +1,185 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "../types/matrix.h"
+#include "householder.h"
+
+namespace linalg {
+
+// Column-pivoted QR with tolerance-based early termination:
+// A * P = Q * R, where P brings the column with the largest remaining norm
+// to the front of every step. Because the trailing column norms are
+// monotonically non-increasing, the factorization can stop as soon as the
+// largest one falls below the tolerance — for a matrix of numerical rank k
+// that is after k steps, O(mnk) work instead of the full O(mn^2).
+//
+// Factors are stored compact (like QRDecomposition::ComputeCompact): R in
+// the upper trapezoid, reflector tails below the diagonal, taus and the
+// column permutation alongside.
+template <typename T>
+class PivotedQRDecomposition {
+public:
+    // relative_tolerance is measured against the largest initial column
+    // norm; the default matches the usual numerical-rank convention.
+    void Compute(Matrix<T> a, T relative_tolerance = T{-1},
+                 Workspace* workspace = nullptr) {
+        Workspace& ws = workspace != nullptr ? *workspace : scratch_;
+        ws.Reset();
+
+        packed_ = std::move(a);
+        std::size_t m = packed_.Rows();
+        std::size_t n = packed_.Cols();
+        std::size_t max_steps = std::min(m, n);
+        if (relative_tolerance < T{}) {
+            relative_tolerance = static_cast<T>(std::max(m, n)) *
+                                 std::numeric_limits<T>::epsilon();
+        }
+
+        permutation_.resize(n);
+        std::iota(permutation_.begin(), permutation_.end(), std::size_t{0});
+        taus_.assign(max_steps, T{});
+
+        // Squared norms of the trailing columns, downdated as rows of R
+        // split off. exact_norms2_ keeps the values from the last full
+        // recompute, to detect when the downdate has cancelled too far.
+        norms2_.resize(n);
+        exact_norms2_.resize(n);
+        for (std::size_t j = 0; j < n; ++j) {
+            T sum{};
+            for (std::size_t i = 0; i < m; ++i) {
+                sum += packed_(i, j) * packed_(i, j);
+            }
+            norms2_[j] = sum;
+            exact_norms2_[j] = sum;
+        }
+        T initial_max = T{};
+        for (std::size_t j = 0; j < n; ++j) {
+            initial_max = std::max(initial_max, norms2_[j]);
+        }
+        T stop = relative_tolerance * relative_tolerance * initial_max;
+
+        rank_ = 0;
+        for (std::size_t k = 0; k < max_steps; ++k) {
+            std::size_t pivot = k;
+            for (std::size_t j = k + 1; j < n; ++j) {
+                if (norms2_[j] > norms2_[pivot]) {
+                    pivot = j;
+                }
+            }
+            // Early stop: every remaining column is numerically inside the
+            // span of the processed ones.
+            if (norms2_[pivot] <= stop) {
+                break;
+            }
+            if (pivot != k) {
+                SwapColumns(k, pivot);
+            }
+
+            ComputeHouseholderInto(reflector_, &packed_(k, k), m - k, n);
+            taus_[k] = reflector_.tau;
+            packed_(k, k) = reflector_.beta;
+            for (std::size_t i = k + 1; i < m; ++i) {
+                packed_(i, k) = reflector_.v[i - k];
+            }
+            ApplyHouseholderLeftThreaded(packed_, reflector_, k, k + 1, &ws);
+
+            // Downdate the trailing norms by the new R row. The downdate
+            // loses roughly half the significant digits to cancellation, so
+            // once a column has shrunk past sqrt(eps) of its last exact
+            // value it gets recomputed from scratch (the dgeqp3 rule).
+            const T recompute_threshold =
+                std::sqrt(std::numeric_limits<T>::epsilon());
+            for (std::size_t j = k + 1; j < n; ++j) {
+                norms2_[j] -= packed_(k, j) * packed_(k, j);
+                if (norms2_[j] < recompute_threshold * exact_norms2_[j]) {
+                    T sum{};
+                    for (std::size_t i = k + 1; i < m; ++i) {
+                        sum += packed_(i, j) * packed_(i, j);
+                    }
+                    norms2_[j] = sum;
+                    exact_norms2_[j] = sum;
+                }
+            }
+            ++rank_;
+        }
+        taus_.resize(rank_);
+    }
+
+    // Number of factorization steps actually taken: the numerical rank at
+    // the requested tolerance.
+    std::size_t Rank() const {
+        return rank_;
+    }
+
+    // Permutation()[j] is the original index of the column standing at
+    // position j of the factored matrix: A[:, Permutation()[j]] equals
+    // column j of Q * R.
+    const std::vector<std::size_t>& Permutation() const {
+        return permutation_;
+    }
+
+    const Matrix<T>& PackedFactors() const {
+        return packed_;
+    }
+
+    // Leading rank x n trapezoid of R.
+    Matrix<T> ExtractR() const {
+        std::size_t n = packed_.Cols();
+        Matrix<T> r(rank_, n);
+        for (std::size_t i = 0; i < rank_; ++i) {
+            for (std::size_t j = i; j < n; ++j) {
+                r(i, j) = packed_(i, j);
+            }
+        }
+        return r;
+    }
+
+    // m x rank orthonormal basis of the (numerical) column space.
+    Matrix<T> MaterializeThinQ() const {
+        std::size_t m = packed_.Rows();
+        Matrix<T> q(m, rank_);
+        for (std::size_t i = 0; i < rank_; ++i) {
+            q(i, i) = T{1};
+        }
+        Householder<T> h;
+        for (std::size_t k = rank_; k-- > 0;) {
+            h.v.resize(m - k);
+            h.v[0] = T{1};
+            for (std::size_t i = k + 1; i < m; ++i) {
+                h.v[i - k] = packed_(i, k);
+            }
+            h.tau = taus_[k];
+            ApplyHouseholderLeft(q, h, k, k);
+        }
+        return q;
+    }
+
+private:
+    void SwapColumns(std::size_t col1, std::size_t col2) {
+        for (std::size_t i = 0; i < packed_.Rows(); ++i) {
+            std::swap(packed_(i, col1), packed_(i, col2));
+        }
+        std::swap(permutation_[col1], permutation_[col2]);
+        std::swap(norms2_[col1], norms2_[col2]);
+        std::swap(exact_norms2_[col1], exact_norms2_[col2]);
+    }
+
+    Matrix<T> packed_;
+    std::vector<T> taus_;
+    std::vector<std::size_t> permutation_;
+    std::vector<T> norms2_;
+    std::vector<T> exact_norms2_;
+    std::size_t rank_ = 0;
+    Householder<T> reflector_;
+    Workspace scratch_;
+};
+
+}  // namespace linalg
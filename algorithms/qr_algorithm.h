@@ -0,0 +1,249 @@
+#pragma once
+
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include "../core/perf.h"
+#include "../core/task_scheduler.h"
+#include "../types/banded_matrix.h"
+#include "../types/matrix.h"
+#include "givens.h"
+#include "hessenberg.h"
+
+namespace linalg {
+
+// QR eigenvalue iteration for symmetric matrices: A = Q * diag(lambda) * Q^T.
+// The input is first reduced to tridiagonal form by Householder similarity
+// transforms, so every subsequent sweep costs O(n^2) instead of O(n^3). Each
+// step then shifts by the Wilkinson estimate from the trailing 2x2 of the
+// active block, giving cubic convergence per eigenvalue, and whenever an
+// off-diagonal entry becomes negligible the problem deflates: the block is
+// split there and the two halves are iterated independently, so converged
+// eigenvalues never participate in further sweeps.
+template <typename T>
+class QRAlgorithm {
+public:
+    void Compute(const Matrix<T>& a, Workspace* workspace = nullptr) {
+        assert(a.Rows() == a.Cols());
+        std::size_t n = a.Rows();
+        perf_.Reset();
+        {
+            perf::ScopedTimer timer(perf_.reduce_seconds);
+            TridiagonalReduce(a, q_, w_, workspace);
+        }
+
+        {
+            perf::ScopedTimer timer(perf_.iterate_seconds);
+            IterateBlock(0, n, scratch_);
+        }
+
+        eigenvalues_.resize(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            eigenvalues_[i] = w_(i, i);
+        }
+        SortDescending();
+    }
+
+    // Warm start from the eigenbasis of a previous, nearby matrix (e.g.
+    // last tick's Eigenvectors()). A is rotated into that basis first,
+    // where it is already near diagonal, so the off-diagonal mass the
+    // reduction and iteration must remove is only the perturbation:
+    // deflations fire almost immediately instead of after full sweeps.
+    // The basis rotation is two GEMMs; the final eigenvectors are mapped
+    // back through the warm-start basis.
+    void Compute(const Matrix<T>& a, const Matrix<T>& warm_start_basis,
+                 Workspace* workspace = nullptr) {
+        assert(warm_start_basis.Rows() == a.Rows() &&
+               warm_start_basis.Cols() == a.Cols());
+        Matrix<T> projected =
+            MultiplyAtB(warm_start_basis, a * warm_start_basis);
+        // The congruence of a symmetric matrix is symmetric; discard the
+        // roundoff skew so Negligible() sees one off-diagonal per pair.
+        for (std::size_t i = 0; i < projected.Rows(); ++i) {
+            for (std::size_t j = i + 1; j < projected.Cols(); ++j) {
+                T avg = (projected(i, j) + projected(j, i)) / T{2};
+                projected(i, j) = avg;
+                projected(j, i) = avg;
+            }
+        }
+        Compute(projected, workspace);
+        q_ = warm_start_basis * q_;
+    }
+
+    const std::vector<T>& Eigenvalues() const {
+        return eigenvalues_;
+    }
+
+    // Column i is the eigenvector for Eigenvalues()[i].
+    const Matrix<T>& Eigenvectors() const {
+        return q_;
+    }
+
+    // Sweep/deflation counts and phase timings of the last Compute call
+    // (all zero unless built with LINALG_ENABLE_PERF).
+    const PerfReport& Perf() const {
+        return perf_;
+    }
+
+private:
+    // Wilkinson shift: the eigenvalue of [[a11, b], [b, a22]] closer to a22.
+    static T WilkinsonShift(T a11, T b, T a22) {
+        T delta = (a11 - a22) / T{2};
+        if (delta == T{} && b == T{}) {
+            return a22;
+        }
+        T sign = delta >= T{} ? T{1} : T{-1};
+        return a22 - sign * b * b / (std::abs(delta) + std::hypot(delta, b));
+    }
+
+    // Returns true when w_(i, i+1) is negligible relative to its diagonal
+    // neighbours, i.e. the block may be split after row i.
+    bool Negligible(std::size_t i) const {
+        const T eps = std::numeric_limits<T>::epsilon();
+        return std::abs(w_(i, i + 1)) <=
+               eps * (std::abs(w_(i, i)) + std::abs(w_(i + 1, i + 1)));
+    }
+
+    // Per-block working storage. Deflated blocks are independent, so a
+    // subtree handed to the scheduler gets its own scratch and the siblings
+    // never contend; the sequential path keeps reusing the same buffer.
+    struct StepScratch {
+        GivensWave<T> wave;
+    };
+
+    // Below this block size a spawned subtree would cost more in task
+    // bookkeeping and fresh scratch than its iteration does.
+    static constexpr std::size_t kParallelDeflationThreshold = 64;
+
+    void IterateBlock(std::size_t lo, std::size_t hi, StepScratch& scratch) {
+        constexpr std::size_t kMaxStepsPerEigenvalue = 100;
+        std::size_t budget = kMaxStepsPerEigenvalue * (hi - lo);
+
+        while (hi - lo > 1 && budget-- > 0) {
+            // Deflate on the first negligible off-diagonal entry and recurse
+            // on the smaller independent blocks. The two halves touch
+            // disjoint slices of the band and disjoint eigenvector columns,
+            // so when both are worth a task the smaller one goes to the
+            // work-stealing scheduler — a static split would leave threads
+            // idle whenever one half dominates, which is the common case.
+            for (std::size_t i = lo; i + 1 < hi; ++i) {
+                if (Negligible(i)) {
+                    ZeroOffDiagonal(i);
+                    std::size_t left = i + 1 - lo;
+                    std::size_t right = hi - i - 1;
+                    if (std::min(left, right) >=
+                        kParallelDeflationThreshold) {
+                        TaskScheduler::TaskGroup group;
+                        group.Spawn([this, lo, i] {
+                            StepScratch local;
+                            IterateBlock(lo, i + 1, local);
+                        });
+                        IterateBlock(i + 1, hi, scratch);
+                        group.Wait();
+                    } else {
+                        IterateBlock(lo, i + 1, scratch);
+                        IterateBlock(i + 1, hi, scratch);
+                    }
+                    return;
+                }
+            }
+
+            ShiftedStep(lo, hi, scratch);
+        }
+    }
+
+    void ZeroOffDiagonal(std::size_t i) {
+        w_.At(i, i + 1) = T{};
+        w_.At(i + 1, i) = T{};
+        perf::Add(perf_.deflations, 1);
+    }
+
+    // One implicit-shift QR step on the block [lo, hi). The first rotation
+    // is chosen against the Wilkinson shift; the bulge it creates is chased
+    // off the band with one Givens similarity per position, so the band work
+    // is O(b) and the matrix never leaves tridiagonal storage. The rotations
+    // are collected into a wave and applied to the eigenvector columns in a
+    // single fused pass, exactly as the SVD driver accumulates its
+    // Golub-Kahan sweeps.
+    void ShiftedStep(std::size_t lo, std::size_t hi, StepScratch& scratch) {
+        std::size_t b = hi - lo;
+        perf::Add(perf_.sweeps, 1);
+        // The band chase and the fused eigenvector column update.
+        perf::Add(perf_.flops, 20 * b + 6 * q_.Rows() * b);
+        T mu = WilkinsonShift(w_(hi - 2, hi - 2), w_(hi - 2, hi - 1),
+                              w_(hi - 1, hi - 1));
+
+        scratch.wave.Reset(lo);
+        T x = w_(lo, lo) - mu;
+        T z = w_(lo, lo + 1);
+        for (std::size_t k = lo; k + 1 < hi; ++k) {
+            GivensRotation<T> g = ComputeGivens(x, z);
+            if (k > lo) {
+                // The rotation folds the bulge back into the band: the
+                // combined magnitude lands on the superdiagonal entry it
+                // sat next to, and the bulge slot becomes exactly zero.
+                w_.At(k - 1, k) = g.r;
+                w_.At(k, k - 1) = g.r;
+            }
+
+            // 2x2 similarity G * [[d_k, e_k], [e_k, d_k1]] * G^T, written
+            // out so the symmetric pair is stored once.
+            T dk = w_(k, k);
+            T dk1 = w_(k + 1, k + 1);
+            T ek = w_(k, k + 1);
+            T cs = g.c * g.s;
+            w_.At(k, k) = g.c * g.c * dk + T{2} * cs * ek + g.s * g.s * dk1;
+            w_.At(k + 1, k + 1) =
+                g.s * g.s * dk - T{2} * cs * ek + g.c * g.c * dk1;
+            T e_new = cs * (dk1 - dk) + (g.c * g.c - g.s * g.s) * ek;
+            w_.At(k, k + 1) = e_new;
+            w_.At(k + 1, k) = e_new;
+
+            if (k + 2 < hi) {
+                // The rotation reaches one entry past the pair and spills a
+                // bulge below it; carry the bulge in z instead of storing it.
+                T next = w_(k + 1, k + 2);
+                z = g.s * next;
+                w_.At(k + 1, k + 2) = g.c * next;
+                w_.At(k + 2, k + 1) = g.c * next;
+                x = e_new;
+            }
+            scratch.wave.Append(g);
+        }
+        // q_[:, lo:hi] *= Qstep, with all b-1 rotations fused per row.
+        ApplyGivensWaveRight(q_, scratch.wave);
+    }
+
+    void SortDescending() {
+        std::size_t n = eigenvalues_.size();
+        for (std::size_t i = 0; i + 1 < n; ++i) {
+            std::size_t largest = i;
+            for (std::size_t j = i + 1; j < n; ++j) {
+                if (eigenvalues_[j] > eigenvalues_[largest]) {
+                    largest = j;
+                }
+            }
+            if (largest != i) {
+                std::swap(eigenvalues_[i], eigenvalues_[largest]);
+                for (std::size_t r = 0; r < q_.Rows(); ++r) {
+                    std::swap(q_(r, i), q_(r, largest));
+                }
+            }
+        }
+    }
+
+    // The working matrix stays symmetric tridiagonal through every step, so
+    // it lives in packed band storage: O(n) instead of O(n^2).
+    BandedMatrix<T> w_;
+    Matrix<T> q_;
+    StepScratch scratch_;
+    std::vector<T> eigenvalues_;
+    // Deflated blocks iterate concurrently; perf::Add keeps the counters
+    // race-free.
+    PerfReport perf_;
+};
+
+}  // namespace linalg
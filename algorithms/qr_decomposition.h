@@ -0,0 +1,240 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "../core/perf.h"
+#include "../types/matrix.h"
+#include "../types/triangular_matrix.h"
+#include "householder.h"
+
+namespace linalg {
+
+template <typename T>
+struct QRResult {
+    Matrix<T> q;
+    Matrix<T> r;
+};
+
+// Householder QR: A = Q * R with Q orthogonal (m x m) and R upper triangular.
+// The trailing-matrix update after each reflector — the bulk of the O(mn^2)
+// work — is split over the global thread pool. Scratch memory comes from the
+// caller's workspace (or an internal one), and the factor storage and
+// reflector buffer are reused across Compute calls, so repeated
+// decompositions of one shape allocate nothing after the first.
+//
+// The layout parameter selects the storage order of the factors and of the
+// working matrix. Column-major keeps the reflector columns and the panel
+// updates unit-stride, which is the natural order for this factorization;
+// row-major remains the default so QRDecomposition<T> composes with the
+// rest of the library unchanged.
+template <typename T, Layout StorageLayout = Layout::kRowMajor>
+class QRDecomposition {
+public:
+    using MatrixType = Matrix<T, kDynamic, kDynamic, StorageLayout>;
+
+    void Compute(const MatrixType& a, Workspace* workspace = nullptr) {
+        r_ = a;
+        Factorize(workspace);
+    }
+
+    // Move-aware variant: adopts the input storage instead of copying it.
+    void Compute(MatrixType&& a, Workspace* workspace = nullptr) {
+        r_ = std::move(a);
+        Factorize(workspace);
+    }
+
+    // Compact (LAPACK-style) factorization: R ends up in the upper triangle
+    // of the input storage and the reflector tails below the diagonal, with
+    // the taus kept alongside. Q is never accumulated — callers that only
+    // need R (or want Q applied implicitly) skip its O(m^2 n) cost and
+    // storage entirely; MaterializeQ() builds it on demand.
+    void ComputeCompact(MatrixType a, Workspace* workspace = nullptr) {
+        Workspace& ws = workspace != nullptr ? *workspace : scratch_;
+        ws.Reset();
+        perf_.Reset();
+        perf::ScopedTimer timer(perf_.factor_seconds);
+        std::size_t arena_before = kPerfEnabled ? ws.CapacityBytes() : 0;
+
+        packed_ = std::move(a);
+        std::size_t m = packed_.Rows();
+        std::size_t n = packed_.Cols();
+        std::size_t steps = std::min(m, n);
+        taus_.resize(steps);
+
+        std::size_t column_stride =
+            StorageLayout == Layout::kColMajor ? 1 : n;
+        for (std::size_t k = 0; k < steps; ++k) {
+            ComputeHouseholderInto(reflector_, &packed_(k, k), m - k,
+                                   column_stride);
+            taus_[k] = reflector_.tau;
+
+            packed_(k, k) = reflector_.beta;
+            for (std::size_t i = k + 1; i < m; ++i) {
+                packed_(i, k) = reflector_.v[i - k];
+            }
+            ApplyHouseholderLeftThreaded(packed_, reflector_, k, k + 1, &ws);
+            perf::Add(perf_.reflectors, 1);
+            perf::Add(perf_.flops, 4 * (m - k) * (n - k));
+        }
+        compact_ = true;
+        perf::Add(perf_.scratch_bytes,
+                  kPerfEnabled ? ws.CapacityBytes() - arena_before : 0);
+    }
+
+    const MatrixType& Q() const {
+        return q_;
+    }
+
+    const MatrixType& R() const {
+        return r_;
+    }
+
+    // Move the factors out when the decomposition object is done with them.
+    MatrixType TakeQ() {
+        return std::move(q_);
+    }
+
+    MatrixType TakeR() {
+        return std::move(r_);
+    }
+
+    // Counters and phase timings of the last Compute/ComputeCompact call
+    // (all zero unless built with LINALG_ENABLE_PERF).
+    const PerfReport& Perf() const {
+        return perf_;
+    }
+
+    // Compact-mode accessors.
+    const MatrixType& PackedFactors() const {
+        assert(compact_);
+        return packed_;
+    }
+
+    MatrixType ExtractR() const {
+        assert(compact_);
+        std::size_t m = packed_.Rows();
+        std::size_t n = packed_.Cols();
+        MatrixType r(m, n);
+        for (std::size_t i = 0; i < m; ++i) {
+            for (std::size_t j = i; j < n; ++j) {
+                r(i, j) = packed_(i, j);
+            }
+        }
+        return r;
+    }
+
+    // Packed triangular copy of R's leading n x n block, so substitution
+    // solves against the factor skip the zero half entirely.
+    TriangularMatrix<T> TriangularR() const {
+        assert(compact_ && packed_.Rows() >= packed_.Cols());
+        std::size_t n = packed_.Cols();
+        TriangularMatrix<T> r(n, TriangularKind::kUpper);
+        for (std::size_t i = 0; i < n; ++i) {
+            for (std::size_t j = i; j < n; ++j) {
+                r.At(i, j) = packed_(i, j);
+            }
+        }
+        return r;
+    }
+
+    // Rebuilds the full orthogonal factor from the stored reflectors. Only
+    // called when a caller actually asks for Q.
+    MatrixType MaterializeQ() const {
+        assert(compact_);
+        perf::ScopedTimer timer(perf_.materialize_seconds);
+        std::size_t m = packed_.Rows();
+        std::size_t steps = taus_.size();
+        MatrixType q = MatrixType::Identity(m);
+
+        Householder<T> h;
+        for (std::size_t k = steps; k-- > 0;) {
+            LoadReflector(h, k);
+            ApplyHouseholderLeft(q, h, k, k);
+        }
+        return q;
+    }
+
+    // Economy-size orthogonal factor: only the leading min(m, n) columns,
+    // built by running the stored reflectors over an m x min(m, n) identity
+    // block. For tall-skinny operands this avoids ever touching an m x m
+    // matrix.
+    MatrixType MaterializeThinQ() const {
+        assert(compact_);
+        perf::ScopedTimer timer(perf_.materialize_seconds);
+        std::size_t m = packed_.Rows();
+        std::size_t steps = taus_.size();
+        MatrixType q(m, steps);
+        for (std::size_t i = 0; i < steps; ++i) {
+            q(i, i) = T{1};
+        }
+
+        Householder<T> h;
+        for (std::size_t k = steps; k-- > 0;) {
+            LoadReflector(h, k);
+            ApplyHouseholderLeft(q, h, k, k);
+        }
+        return q;
+    }
+
+private:
+    // Rehydrates reflector k from the packed storage (tail below the
+    // diagonal of column k, unit head implied).
+    void LoadReflector(Householder<T>& h, std::size_t k) const {
+        std::size_t m = packed_.Rows();
+        h.v.resize(m - k);
+        h.v[0] = T{1};
+        for (std::size_t i = k + 1; i < m; ++i) {
+            h.v[i - k] = packed_(i, k);
+        }
+        h.tau = taus_[k];
+    }
+
+    void Factorize(Workspace* workspace) {
+        Workspace& ws = workspace != nullptr ? *workspace : scratch_;
+        ws.Reset();
+        perf_.Reset();
+        perf::ScopedTimer timer(perf_.factor_seconds);
+        std::size_t arena_before = kPerfEnabled ? ws.CapacityBytes() : 0;
+
+        std::size_t m = r_.Rows();
+        std::size_t n = r_.Cols();
+        q_.SetIdentity(m);
+        compact_ = false;
+
+        std::size_t steps = std::min(m, n);
+        std::size_t column_stride =
+            StorageLayout == Layout::kColMajor ? 1 : n;
+        for (std::size_t k = 0; k < steps; ++k) {
+            ComputeHouseholderInto(reflector_, &r_(k, k), m - k,
+                                   column_stride);
+
+            r_(k, k) = reflector_.beta;
+            for (std::size_t i = k + 1; i < m; ++i) {
+                r_(i, k) = T{};
+            }
+            ApplyHouseholderLeftThreaded(r_, reflector_, k, k + 1, &ws);
+            ApplyHouseholderRightThreaded(q_, reflector_, 0, k);
+            perf::Add(perf_.reflectors, 1);
+            perf::Add(perf_.flops,
+                      4 * (m - k) * (n - k) + 4 * m * (m - k));
+        }
+        perf::Add(perf_.scratch_bytes,
+                  kPerfEnabled ? ws.CapacityBytes() - arena_before : 0);
+    }
+
+    MatrixType q_;
+    MatrixType r_;
+    MatrixType packed_;
+    std::vector<T> taus_;
+    bool compact_ = false;
+    Householder<T> reflector_;
+    Workspace scratch_;
+    // mutable so the const materialization accessors can record their time.
+    mutable PerfReport perf_;
+};
+
+}  // namespace linalg
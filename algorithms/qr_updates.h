@@ -0,0 +1,189 @@
+#pragma once
+
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <utility>
+
+#include "../core/kernel_registry.h"
+#include "../types/matrix.h"
+#include "givens.h"
+#include "qr_decomposition.h"
+
+namespace linalg {
+
+// Thin QR factors maintained under incremental changes. For a pipeline
+// that perturbs a few rows per tick, AppendRow is O(m n) and RankOneUpdate
+// is O(m n + n^2) — against the O(m n^2) of refactoring from scratch, an
+// order of magnitude at typical shapes. Modifying row k in place is
+// RankOneUpdate with u = e_k and v = (new row - old row); zeroing a row
+// out retires it without shrinking the factor.
+//
+// The rotations that restore the triangle hit rows of R with the
+// unit-stride registry kernel and columns of Q with the strided apply.
+template <typename T>
+class UpdatableQR {
+public:
+    // Factors a (m >= n) into thin Q (m x n) and R (n x n).
+    void Initialize(const Matrix<T>& a, Workspace* workspace = nullptr) {
+        assert(a.Rows() >= a.Cols());
+        QRDecomposition<T> qr;
+        qr.ComputeCompact(a, workspace);
+        q_ = qr.MaterializeThinQ();
+        std::size_t n = a.Cols();
+        r_.Resize(n, n);
+        for (std::size_t i = 0; i < n; ++i) {
+            for (std::size_t j = 0; j < n; ++j) {
+                r_(i, j) = j >= i ? qr.PackedFactors()(i, j) : T{};
+            }
+        }
+    }
+
+    const Matrix<T>& Q() const {
+        return q_;
+    }
+
+    const Matrix<T>& R() const {
+        return r_;
+    }
+
+    // Appends the length-n row v to the factored matrix. The new row joins
+    // as an extra coordinate direction; n Givens rotations chase it into
+    // the triangle and fold the direction back into Q's columns.
+    void AppendRow(const T* v) {
+        std::size_t m = q_.Rows();
+        std::size_t n = r_.Cols();
+
+        // Extended factors: Q gains a zero row plus the unit column for
+        // the new coordinate; the row itself sits below R.
+        GrowQ(1);
+        row_.Resize(1, n);
+        for (std::size_t j = 0; j < n; ++j) {
+            row_(0, j) = v[j];
+        }
+
+        for (std::size_t i = 0; i < n; ++i) {
+            GivensRotation<T> g = ComputeGivens(r_(i, i), row_(0, i));
+            r_(i, i) = g.r;
+            row_(0, i) = T{};
+            if (i + 1 < n) {
+                simd::GivensApply(g.c, g.s, &r_(i, i + 1), &row_(0, i + 1),
+                                  n - i - 1);
+            }
+            ApplyGivensRight(q_, g.c, g.s, i, n);
+        }
+        DropLastColumnOfQ(m + 1);
+    }
+
+    // A <- A + u * v^T for u of length Rows() and v of length Cols().
+    void RankOneUpdate(const T* u, const T* v) {
+        std::size_t m = q_.Rows();
+        std::size_t n = r_.Cols();
+
+        // Split u into Q w + rho * q_perp and extend the factors by the
+        // perpendicular direction, so the update lives entirely inside the
+        // extended basis: A' = Q1 * ([R; 0] + w1 * v^T).
+        w_.Resize(n + 1, 1);
+        for (std::size_t j = 0; j < n; ++j) {
+            T dot{};
+            for (std::size_t i = 0; i < m; ++i) {
+                dot += q_(i, j) * u[i];
+            }
+            w_(j, 0) = dot;
+        }
+        GrowQ(0);
+        T rho2{};
+        for (std::size_t i = 0; i < m; ++i) {
+            T residual = u[i];
+            for (std::size_t j = 0; j < n; ++j) {
+                residual -= q_(i, j) * w_(j, 0);
+            }
+            q_(i, n) = residual;
+            rho2 += residual * residual;
+        }
+        T rho = std::sqrt(rho2);
+        w_(n, 0) = rho;
+        if (rho != T{}) {
+            for (std::size_t i = 0; i < m; ++i) {
+                q_(i, n) /= rho;
+            }
+        }
+        row_.Resize(1, n);
+        for (std::size_t j = 0; j < n; ++j) {
+            row_(0, j) = T{};
+        }
+
+        // Rotate w1 onto e_0 from the bottom; R picks up one subdiagonal
+        // per rotation and becomes upper Hessenberg (the extra row row_
+        // stands in for R's phantom zero row n).
+        for (std::size_t i = n; i-- > 0;) {
+            GivensRotation<T> g = ComputeGivens(w_(i, 0), w_(i + 1, 0));
+            w_(i, 0) = g.r;
+            w_(i + 1, 0) = T{};
+            T* upper = &r_(i, 0);
+            T* lower = i + 1 < n ? &r_(i + 1, 0) : &row_(0, 0);
+            simd::GivensApply(g.c, g.s, upper, lower, n);
+            ApplyGivensRight(q_, g.c, g.s, i, i + 1);
+        }
+
+        // The whole update is now confined to row 0.
+        simd::Axpy(w_(0, 0), v, &r_(0, 0), n);
+
+        // Chase the Hessenberg subdiagonal back out, top-down.
+        for (std::size_t i = 0; i < n; ++i) {
+            T* lower = i + 1 < n ? &r_(i + 1, 0) : &row_(0, 0);
+            GivensRotation<T> g = ComputeGivens(r_(i, i), lower[i]);
+            r_(i, i) = g.r;
+            lower[i] = T{};
+            if (i + 1 < n) {
+                simd::GivensApply(g.c, g.s, &r_(i, i + 1), lower + i + 1,
+                                  n - i - 1);
+            }
+            ApplyGivensRight(q_, g.c, g.s, i, i + 1);
+        }
+        DropLastColumnOfQ(m);
+    }
+
+private:
+    // Widens Q by one zero column, optionally also adding extra_rows zero
+    // rows, preserving the existing block.
+    void GrowQ(std::size_t extra_rows) {
+        std::size_t m = q_.Rows();
+        std::size_t n = q_.Cols();
+        grown_.Resize(m + extra_rows, n + 1);
+        for (std::size_t i = 0; i < m; ++i) {
+            for (std::size_t j = 0; j < n; ++j) {
+                grown_(i, j) = q_(i, j);
+            }
+            grown_(i, n) = T{};
+        }
+        for (std::size_t i = m; i < m + extra_rows; ++i) {
+            for (std::size_t j = 0; j < n; ++j) {
+                grown_(i, j) = T{};
+            }
+            grown_(i, n) = T{1};
+        }
+        std::swap(q_, grown_);
+    }
+
+    // The extended R row is zero again, so the extra basis column carries
+    // nothing and the factor shrinks back to thin shape.
+    void DropLastColumnOfQ(std::size_t rows) {
+        std::size_t n = q_.Cols() - 1;
+        grown_.Resize(rows, n);
+        for (std::size_t i = 0; i < rows; ++i) {
+            for (std::size_t j = 0; j < n; ++j) {
+                grown_(i, j) = q_(i, j);
+            }
+        }
+        std::swap(q_, grown_);
+    }
+
+    Matrix<T> q_;
+    Matrix<T> r_;
+    Matrix<T> w_;
+    Matrix<T> row_;
+    Matrix<T> grown_;
+};
+
+}  // namespace linalg
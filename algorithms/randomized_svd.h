@@ -0,0 +1,141 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+
+#include "../types/matrix.h"
+#include "qr_decomposition.h"
+#include "svd.h"
+
+namespace linalg {
+
+// Knobs for the randomized range finder. The defaults follow the usual
+// recommendations: a handful of oversampling columns to make the sketch
+// capture the range with high probability, and a couple of power iterations
+// to sharpen the spectrum when the singular values decay slowly.
+struct RandomizedSVDOptions {
+    std::size_t oversample = 10;
+    std::size_t power_iterations = 2;
+    std::uint64_t seed = 20231107;
+};
+
+namespace detail {
+
+// Thin orthonormal basis of the columns of y, via compact QR. Reuses the
+// decomposition object across calls within one driver run.
+template <typename T>
+Matrix<T> Orthonormalize(QRDecomposition<T>& qr, Matrix<T>&& y,
+                         Workspace* workspace) {
+    qr.ComputeCompact(std::move(y), workspace);
+    return qr.MaterializeThinQ();
+}
+
+}  // namespace detail
+
+// Randomized truncated SVD (Halko/Martinsson/Tropp): sketches the range of A
+// with a Gaussian test matrix, orthonormalizes the sketch, and runs the
+// dense SVD only on the small projected core B = Q^T * A. For an m x n input
+// and target rank k the expensive dense work drops from O(m * n * min(m, n))
+// to O(m * n * (k + oversample)), at the cost of a small, controllable
+// approximation error in the trailing retained values.
+template <typename T>
+SVDResult<T> RandomizedSVD(const Matrix<T>& a, std::size_t rank,
+                           const RandomizedSVDOptions& options = {},
+                           Workspace* workspace = nullptr) {
+    std::size_t m = a.Rows();
+    std::size_t n = a.Cols();
+    assert(rank > 0 && rank <= std::min(m, n));
+    std::size_t sketch_cols =
+        std::min(rank + options.oversample, std::min(m, n));
+
+    // Gaussian sketch Y = A * Omega; each column of Y is a random linear
+    // combination of the columns of A, so together they span the numerical
+    // range of A up to the sketch width.
+    std::mt19937_64 gen(options.seed);
+    std::normal_distribution<T> gauss(T{}, T{1});
+    Matrix<T> omega(n, sketch_cols);
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = 0; j < sketch_cols; ++j) {
+            omega(i, j) = gauss(gen);
+        }
+    }
+
+    QRDecomposition<T> qr;
+    Matrix<T> q = detail::Orthonormalize(qr, a * omega, workspace);
+
+    // Power iterations replace the sketch of A by a sketch of
+    // (A * A^T)^p * A, which shares A's singular vectors but has its
+    // spectrum raised to the power 2p + 1 — the subspace snaps onto the
+    // dominant directions much faster. Re-orthonormalizing between the two
+    // half-steps keeps the columns from collapsing onto the top vector.
+    for (std::size_t iter = 0; iter < options.power_iterations; ++iter) {
+        q = detail::Orthonormalize(qr, MultiplyAtB(a, q), workspace);
+        q = detail::Orthonormalize(qr, a * q, workspace);
+    }
+
+    // All the remaining dense work happens on the small core.
+    Matrix<T> core = MultiplyAtB(q, a);
+    SVDDecomposition<T> svd;
+    svd.Compute(core, SVDMode::kTopK, rank, workspace);
+
+    SVDResult<T> result;
+    result.u = q * svd.U();
+    result.singular_values = svd.SingularValues();
+    result.v = svd.V();
+    return result;
+}
+
+// Warm-started variant: the sketch is seeded with a subspace that already
+// approximates the dominant right singular vectors — typically result.v of
+// the previous tick on a slowly evolving matrix. The range finder then
+// starts essentially converged, so one power iteration (often zero)
+// suffices where the cold start needs its full budget; the randomized
+// guarantees are kept by padding the subspace with Gaussian columns up to
+// the oversampled sketch width.
+template <typename T>
+SVDResult<T> RandomizedSVD(const Matrix<T>& a, std::size_t rank,
+                           const Matrix<T>& warm_start,
+                           const RandomizedSVDOptions& options = {},
+                           Workspace* workspace = nullptr) {
+    std::size_t m = a.Rows();
+    std::size_t n = a.Cols();
+    assert(rank > 0 && rank <= std::min(m, n));
+    assert(warm_start.Rows() == n && warm_start.Cols() > 0);
+    std::size_t sketch_cols =
+        std::min(rank + options.oversample, std::min(m, n));
+    std::size_t carried = std::min(warm_start.Cols(), sketch_cols);
+
+    std::mt19937_64 gen(options.seed);
+    std::normal_distribution<T> gauss(T{}, T{1});
+    Matrix<T> omega(n, sketch_cols);
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = 0; j < carried; ++j) {
+            omega(i, j) = warm_start(i, j);
+        }
+        for (std::size_t j = carried; j < sketch_cols; ++j) {
+            omega(i, j) = gauss(gen);
+        }
+    }
+
+    QRDecomposition<T> qr;
+    Matrix<T> q = detail::Orthonormalize(qr, a * omega, workspace);
+    for (std::size_t iter = 0; iter < options.power_iterations; ++iter) {
+        q = detail::Orthonormalize(qr, MultiplyAtB(a, q), workspace);
+        q = detail::Orthonormalize(qr, a * q, workspace);
+    }
+
+    Matrix<T> core = MultiplyAtB(q, a);
+    SVDDecomposition<T> svd;
+    svd.Compute(core, SVDMode::kTopK, rank, workspace);
+
+    SVDResult<T> result;
+    result.u = q * svd.U();
+    result.singular_values = svd.SingularValues();
+    result.v = svd.V();
+    return result;
+}
+
+}  // namespace linalg
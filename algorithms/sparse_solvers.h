@@ -0,0 +1,179 @@
+#pragma once
+
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+
+#include "../core/simd.h"
+#include "../types/matrix.h"
+#include "../types/sparse_matrix.h"
+
+namespace linalg {
+
+// Shared knobs for the matrix-free solvers below. max_iterations of zero
+// picks a dimension-scaled default; the tolerance is relative to the norm
+// of the right-hand side.
+template <typename T>
+struct IterativeSolverOptions {
+    std::size_t max_iterations = 0;
+    T tolerance = std::numeric_limits<T>::epsilon() * T{1000};
+};
+
+template <typename T>
+struct IterativeSolverResult {
+    Matrix<T> x;
+    std::size_t iterations = 0;
+    bool converged = false;
+};
+
+namespace detail {
+
+template <typename T>
+T ColumnNorm(const Matrix<T>& v) {
+    return std::sqrt(simd::Dot(v.Data(), v.Data(), v.Rows()));
+}
+
+}  // namespace detail
+
+// Conjugate gradient for symmetric positive definite systems A x = b. The
+// matrix is touched only through SpMV, so each iteration costs O(nnz) — the
+// whole point of keeping the Laplacian sparse. b is a single column.
+template <typename T>
+IterativeSolverResult<T> ConjugateGradient(
+    const SparseMatrix<T>& a, const Matrix<T>& b,
+    IterativeSolverOptions<T> options = {}) {
+    assert(a.Rows() == a.Cols() && b.Rows() == a.Rows() && b.Cols() == 1);
+    std::size_t n = a.Rows();
+    std::size_t max_iterations =
+        options.max_iterations != 0 ? options.max_iterations : 2 * n;
+
+    IterativeSolverResult<T> result;
+    result.x = Matrix<T>(n, 1);
+    Matrix<T> residual = b;
+    Matrix<T> direction = residual;
+    T rho = simd::Dot(residual.Data(), residual.Data(), n);
+    T threshold = options.tolerance * detail::ColumnNorm(b);
+    threshold *= threshold;
+
+    while (result.iterations < max_iterations) {
+        if (rho <= threshold) {
+            result.converged = true;
+            break;
+        }
+        Matrix<T> a_direction = a * direction;
+        T alpha =
+            rho / simd::Dot(direction.Data(), a_direction.Data(), n);
+        simd::Axpy(alpha, direction.Data(), result.x.Data(), n);
+        simd::Axpy(-alpha, a_direction.Data(), residual.Data(), n);
+
+        T rho_next = simd::Dot(residual.Data(), residual.Data(), n);
+        T beta = rho_next / rho;
+        for (std::size_t i = 0; i < n; ++i) {
+            direction(i, 0) = residual(i, 0) + beta * direction(i, 0);
+        }
+        rho = rho_next;
+        ++result.iterations;
+    }
+    result.converged = result.converged || rho <= threshold;
+    return result;
+}
+
+// LSQR (Paige & Saunders): minimizes ||A x - b|| for rectangular A via
+// Golub-Kahan bidiagonalization, using only A * v and A^T * u products.
+// Equivalent to CG on the normal equations but numerically far better
+// behaved, which matters for the ill-conditioned graph systems this is for.
+template <typename T>
+IterativeSolverResult<T> LSQR(const SparseMatrix<T>& a, const Matrix<T>& b,
+                              IterativeSolverOptions<T> options = {}) {
+    assert(b.Rows() == a.Rows() && b.Cols() == 1);
+    std::size_t m = a.Rows();
+    std::size_t n = a.Cols();
+    std::size_t max_iterations =
+        options.max_iterations != 0 ? options.max_iterations : 2 * n;
+
+    IterativeSolverResult<T> result;
+    result.x = Matrix<T>(n, 1);
+
+    Matrix<T> u = b;
+    T beta = detail::ColumnNorm(u);
+    if (beta == T{}) {
+        result.converged = true;
+        return result;
+    }
+    for (std::size_t i = 0; i < m; ++i) {
+        u(i, 0) /= beta;
+    }
+
+    Matrix<T> v = MultiplyAtB(a, u);
+    T alpha = detail::ColumnNorm(v);
+    if (alpha == T{}) {
+        result.converged = true;
+        return result;
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+        v(i, 0) /= alpha;
+    }
+
+    Matrix<T> w = v;
+    T phi_bar = beta;
+    T rho_bar = alpha;
+    T b_norm = beta;
+    T a_norm2 = T{};
+
+    while (result.iterations < max_iterations) {
+        // Next Golub-Kahan step: beta * u = A v - alpha u,
+        // alpha * v = A^T u - beta v.
+        Matrix<T> av = a * v;
+        simd::Axpy(-alpha, u.Data(), av.Data(), m);
+        u = std::move(av);
+        beta = detail::ColumnNorm(u);
+        if (beta != T{}) {
+            for (std::size_t i = 0; i < m; ++i) {
+                u(i, 0) /= beta;
+            }
+        }
+
+        Matrix<T> atu = MultiplyAtB(a, u);
+        simd::Axpy(-beta, v.Data(), atu.Data(), n);
+        v = std::move(atu);
+        alpha = detail::ColumnNorm(v);
+        if (alpha != T{}) {
+            for (std::size_t i = 0; i < n; ++i) {
+                v(i, 0) /= alpha;
+            }
+        }
+
+        // Givens rotation eliminating beta from the lower bidiagonal.
+        T rho = std::sqrt(rho_bar * rho_bar + beta * beta);
+        T c = rho_bar / rho;
+        T s = beta / rho;
+        T theta = s * alpha;
+        rho_bar = -c * alpha;
+        T phi = c * phi_bar;
+        phi_bar = s * phi_bar;
+
+        simd::Axpy(phi / rho, w.Data(), result.x.Data(), n);
+        for (std::size_t i = 0; i < n; ++i) {
+            w(i, 0) = v(i, 0) - (theta / rho) * w(i, 0);
+        }
+        ++result.iterations;
+
+        // Two stopping rules, as in the original algorithm: phi_bar is the
+        // residual norm (hits zero only for consistent systems), and
+        // phi_bar * alpha * |c| estimates ||A^T r||, which vanishes at any
+        // least-squares solution.
+        a_norm2 += alpha * alpha + beta * beta;
+        T normal_residual = phi_bar * alpha * (c < T{} ? -c : c);
+        if (phi_bar <= options.tolerance * b_norm ||
+            normal_residual <=
+                options.tolerance * std::sqrt(a_norm2) * phi_bar ||
+            alpha == T{} || beta == T{}) {
+            result.converged = true;
+            break;
+        }
+    }
+    return result;
+}
+
+}  // namespace linalg
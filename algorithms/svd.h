@@ -0,0 +1,348 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+#include "../core/perf.h"
+#include "../types/matrix.h"
+#include "bidiagonalization.h"
+#include "givens.h"
+
+namespace linalg {
+
+// What the SVD driver should produce besides the singular values.
+enum class SVDMode {
+    kFull,        // m x m U and n x n V
+    kValuesOnly,  // no U or V at all; skips every rotation accumulation
+    kThin,        // U and V truncated to min(m, n) columns
+    kTopK,        // U and V truncated to the leading k columns
+};
+
+// A decomposition's factors as plain values, for drivers that hand results
+// back instead of keeping them inside a decomposition object.
+template <typename T>
+struct SVDResult {
+    Matrix<T> u;
+    std::vector<T> singular_values;
+    Matrix<T> v;
+};
+
+// Singular value decomposition A = U * S * V^T. The driver reduces A to upper
+// bidiagonal form with Householder reflectors, then runs the implicit-shift
+// Golub-Kahan QR iteration on the bidiagonal band, accumulating the Givens
+// rotations into U and V. Singular values come out nonnegative and sorted in
+// descending order.
+template <typename T>
+class SVDDecomposition {
+public:
+    void Compute(const Matrix<T>& a, Workspace* workspace = nullptr) {
+        Compute(a, SVDMode::kFull, 0, workspace);
+    }
+
+    // top_k is only read in kTopK mode.
+    void Compute(const Matrix<T>& a, SVDMode mode, std::size_t top_k = 0,
+                 Workspace* workspace = nullptr) {
+        Workspace& ws = workspace != nullptr ? *workspace : scratch_;
+        ws.Reset();
+        perf_.Reset();
+        std::size_t arena_before = kPerfEnabled ? ws.CapacityBytes() : 0;
+        accumulate_ = mode != SVDMode::kValuesOnly;
+        if (a.Rows() >= a.Cols()) {
+            ComputeTall(a, ws);
+        } else {
+            // Work on the transpose so the bidiagonal core always sees
+            // m >= n, then swap the factors back.
+            ComputeTall(a.Transpose(), ws);
+            std::swap(u_, v_);
+        }
+
+        if (mode == SVDMode::kThin) {
+            TruncateFactors(singular_values_.size());
+        } else if (mode == SVDMode::kTopK) {
+            TruncateFactors(std::min(top_k, singular_values_.size()));
+            singular_values_.resize(
+                std::min(top_k, singular_values_.size()));
+        }
+        perf::Add(perf_.scratch_bytes,
+                  kPerfEnabled ? ws.CapacityBytes() - arena_before : 0);
+    }
+
+    const Matrix<T>& U() const {
+        return u_;
+    }
+
+    const Matrix<T>& V() const {
+        return v_;
+    }
+
+    const std::vector<T>& SingularValues() const {
+        return singular_values_;
+    }
+
+    // Sweep/deflation counts and phase timings of the last Compute call
+    // (all zero unless built with LINALG_ENABLE_PERF).
+    const PerfReport& Perf() const {
+        return perf_;
+    }
+
+    // Materializes S with the shape matching the produced factors, so
+    // A == U() * SigmaMatrix() * V().Transpose() in every mode that
+    // accumulates factors; after kValuesOnly both factors are empty and the
+    // result is the empty matrix, so read SingularValues() instead.
+    Matrix<T> SigmaMatrix() const {
+        Matrix<T> sigma(u_.Cols(), v_.Cols());
+        std::size_t diagonal = std::min(
+            singular_values_.size(), std::min(u_.Cols(), v_.Cols()));
+        for (std::size_t i = 0; i < diagonal; ++i) {
+            sigma(i, i) = singular_values_[i];
+        }
+        return sigma;
+    }
+
+private:
+    void ComputeTall(const Matrix<T>& a, Workspace& workspace) {
+        std::size_t n = a.Cols();
+        {
+            perf::ScopedTimer timer(perf_.reduce_seconds);
+            if (accumulate_) {
+                Bidiagonalize(a, u_, bidiagonal_, v_, &workspace);
+            } else {
+                Bidiagonalize(a, bidiagonal_, &workspace);
+                u_.Resize(0, 0);
+                v_.Resize(0, 0);
+            }
+            // One left and one right reflector per column of the core.
+            perf::Add(perf_.reflectors, 2 * n);
+        }
+
+        singular_values_.resize(n);
+        super_.resize(n > 0 ? n - 1 : 0);
+        for (std::size_t i = 0; i < n; ++i) {
+            singular_values_[i] = bidiagonal_(i, i);
+        }
+        for (std::size_t i = 0; i + 1 < n; ++i) {
+            super_[i] = bidiagonal_(i, i + 1);
+        }
+
+        {
+            perf::ScopedTimer timer(perf_.iterate_seconds);
+            IterateBidiagonal(singular_values_, super_);
+        }
+        FixSignsAndSort(singular_values_);
+    }
+
+    void IterateBidiagonal(std::vector<T>& d, std::vector<T>& e) {
+        const T eps = std::numeric_limits<T>::epsilon();
+        std::size_t n = d.size();
+        if (n == 0) {
+            return;
+        }
+
+        std::size_t max_sweeps = 100 * n;
+        std::size_t q = n;
+        for (std::size_t sweep = 0; sweep < max_sweeps && q > 1; ++sweep) {
+            perf::Add(perf_.sweeps, 1);
+            for (std::size_t i = 0; i + 1 < q; ++i) {
+                if (std::abs(e[i]) <=
+                    eps * (std::abs(d[i]) + std::abs(d[i + 1]))) {
+                    if (e[i] != T{}) {
+                        perf::Add(perf_.deflations, 1);
+                    }
+                    e[i] = T{};
+                }
+            }
+            while (q > 1 && e[q - 2] == T{}) {
+                --q;
+            }
+            if (q <= 1) {
+                break;
+            }
+            std::size_t l = q - 2;
+            while (l > 0 && e[l - 1] != T{}) {
+                --l;
+            }
+
+            // A negligible diagonal inside the block would make the shift
+            // singular; rotate its superdiagonal entry off the matrix first.
+            bool deflated_zero = false;
+            for (std::size_t i = l; i + 1 < q; ++i) {
+                if (std::abs(d[i]) <= eps * (std::abs(d[i]) + std::abs(e[i]) +
+                                             std::abs(d[i + 1]))) {
+                    ChaseZeroDiagonal(d, e, i, q);
+                    deflated_zero = true;
+                    break;
+                }
+            }
+            if (deflated_zero) {
+                continue;
+            }
+
+            GolubKahanStep(d, e, l, q);
+        }
+    }
+
+    // Eliminates row i of the bidiagonal block when d[i] ~ 0 by rotating it
+    // against the rows below, which zeroes e[i] without perturbing the rest
+    // of the band structure.
+    void ChaseZeroDiagonal(std::vector<T>& d, std::vector<T>& e,
+                           std::size_t i, std::size_t q) {
+        T f = e[i];
+        e[i] = T{};
+        d[i] = T{};
+        for (std::size_t j = i + 1; j < q && f != T{}; ++j) {
+            GivensRotation<T> g = ComputeGivens(d[j], f);
+            d[j] = g.r;
+            if (accumulate_) {
+                ApplyGivensRight(u_, g.c, g.s, j, i);
+            }
+            if (j + 1 < q) {
+                f = -g.s * e[j];
+                e[j] = g.c * e[j];
+            }
+        }
+    }
+
+    // One implicit-shift QR sweep on the block [l, q): the first rotation is
+    // chosen from the Wilkinson shift of the trailing 2x2 of B^T * B, then
+    // the bulge is chased down the band with alternating right and left
+    // rotations, each accumulated into V and U respectively.
+    void GolubKahanStep(std::vector<T>& d, std::vector<T>& e, std::size_t l,
+                        std::size_t q) {
+        T t11 = d[q - 2] * d[q - 2] +
+                (q >= l + 3 ? e[q - 3] * e[q - 3] : T{});
+        T t12 = d[q - 2] * e[q - 2];
+        T t22 = d[q - 1] * d[q - 1] + e[q - 2] * e[q - 2];
+        T delta = (t11 - t22) / T{2};
+        T denom = delta + (delta >= T{} ? T{1} : T{-1}) *
+                              std::hypot(delta, t12);
+        T mu = (denom != T{}) ? t22 - t12 * t12 / denom : t22;
+
+        T y = d[l] * d[l] - mu;
+        T z = d[l] * e[l];
+
+        u_wave_.Reset(l);
+        v_wave_.Reset(l);
+
+        GivensRotation<T> g = ComputeGivens(y, z);
+        T bulge;
+        {
+            // Right rotation on columns (l, l+1).
+            T dl = d[l];
+            T el = e[l];
+            d[l] = g.c * dl + g.s * el;
+            e[l] = -g.s * dl + g.c * el;
+            bulge = g.s * d[l + 1];
+            d[l + 1] = g.c * d[l + 1];
+            v_wave_.Append(g);
+        }
+
+        for (std::size_t k = l; k + 1 < q; ++k) {
+            // Left rotation on rows (k, k+1) annihilates the bulge at
+            // B(k+1, k).
+            g = ComputeGivens(d[k], bulge);
+            d[k] = g.r;
+            T ek = e[k];
+            T dk1 = d[k + 1];
+            e[k] = g.c * ek + g.s * dk1;
+            d[k + 1] = -g.s * ek + g.c * dk1;
+            T bulge2 = T{};
+            if (k + 2 < q) {
+                bulge2 = g.s * e[k + 1];
+                e[k + 1] = g.c * e[k + 1];
+            }
+            u_wave_.Append(g);
+
+            if (k + 2 < q) {
+                // Right rotation on columns (k+1, k+2) annihilates the bulge
+                // at B(k, k+2).
+                g = ComputeGivens(e[k], bulge2);
+                e[k] = g.r;
+                T dk = d[k + 1];
+                T ek1 = e[k + 1];
+                d[k + 1] = g.c * dk + g.s * ek1;
+                e[k + 1] = -g.s * dk + g.c * ek1;
+                bulge = g.s * d[k + 2];
+                d[k + 2] = g.c * d[k + 2];
+                v_wave_.Append(g);
+            }
+        }
+
+        // The whole step's rotations hit U and V as two fused waves, so each
+        // row of the accumulators is touched once per sweep.
+        if (accumulate_) {
+            ApplyGivensWaveRight(u_, u_wave_);
+            ApplyGivensWaveRight(v_, v_wave_);
+        }
+    }
+
+    static void SwapColumns(Matrix<T>& m, std::size_t col1,
+                            std::size_t col2) {
+        for (std::size_t r = 0; r < m.Rows(); ++r) {
+            std::swap(m(r, col1), m(r, col2));
+        }
+    }
+
+    // Flips negative values into U's columns and selection-sorts the spectrum
+    // descending with in-place column swaps, so no per-call temporaries are
+    // needed.
+    void FixSignsAndSort(std::vector<T>& d) {
+        std::size_t n = d.size();
+        for (std::size_t i = 0; i < n; ++i) {
+            if (d[i] < T{}) {
+                d[i] = -d[i];
+                for (std::size_t r = 0; r < u_.Rows(); ++r) {
+                    u_(r, i) = -u_(r, i);
+                }
+            }
+        }
+
+        for (std::size_t i = 0; i + 1 < n; ++i) {
+            std::size_t largest = i;
+            for (std::size_t j = i + 1; j < n; ++j) {
+                if (d[j] > d[largest]) {
+                    largest = j;
+                }
+            }
+            if (largest != i) {
+                std::swap(d[i], d[largest]);
+                SwapColumns(u_, i, largest);
+                SwapColumns(v_, i, largest);
+            }
+        }
+    }
+
+    // Copies the leading k columns of U and V into compact factors.
+    void TruncateFactors(std::size_t k) {
+        Matrix<T> u_thin(u_.Rows(), k);
+        for (std::size_t i = 0; i < u_.Rows(); ++i) {
+            for (std::size_t j = 0; j < k; ++j) {
+                u_thin(i, j) = u_(i, j);
+            }
+        }
+        Matrix<T> v_thin(v_.Rows(), k);
+        for (std::size_t i = 0; i < v_.Rows(); ++i) {
+            for (std::size_t j = 0; j < k; ++j) {
+                v_thin(i, j) = v_(i, j);
+            }
+        }
+        u_ = std::move(u_thin);
+        v_ = std::move(v_thin);
+    }
+
+    Matrix<T> u_;
+    Matrix<T> v_;
+    Matrix<T> bidiagonal_;
+    GivensWave<T> u_wave_;
+    GivensWave<T> v_wave_;
+    bool accumulate_ = true;
+    std::vector<T> singular_values_;
+    std::vector<T> super_;
+    Workspace scratch_;
+    PerfReport perf_;
+};
+
+}  // namespace linalg
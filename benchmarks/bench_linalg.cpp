@@ -0,0 +1,102 @@
+#include <cstddef>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../algorithms/bidiagonalization.h"
+#include "../algorithms/qr_decomposition.h"
+#include "../algorithms/svd.h"
+#include "../types/matrix.h"
+#include "benchmark_runner.h"
+
+using namespace linalg;
+using namespace linalg::bench;
+
+namespace {
+
+Matrix<double> RandomMatrix(std::size_t rows, std::size_t cols) {
+    static std::mt19937 generator(20231107);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    Matrix<double> result(rows, cols);
+    for (std::size_t i = 0; i < rows; ++i) {
+        for (std::size_t j = 0; j < cols; ++j) {
+            result(i, j) = dist(generator);
+        }
+    }
+    return result;
+}
+
+void BenchGemm(BenchmarkRunner& runner, std::size_t n) {
+    Matrix<double> a = RandomMatrix(n, n);
+    Matrix<double> b = RandomMatrix(n, n);
+    double flops = 2.0 * n * n * n;
+    runner.Run("gemm/" + std::to_string(n), flops, [&] {
+        Matrix<double> c = a * b;
+        (void)c;
+    });
+}
+
+void BenchQR(BenchmarkRunner& runner, std::size_t n) {
+    Matrix<double> a = RandomMatrix(n, n);
+    QRDecomposition<double> qr;
+    Workspace ws;
+    double flops = 4.0 / 3.0 * n * n * n;
+    runner.Run("householder_qr/" + std::to_string(n), flops,
+               [&] { qr.Compute(a, &ws); });
+}
+
+void BenchBidiagonalize(BenchmarkRunner& runner, std::size_t n) {
+    Matrix<double> a = RandomMatrix(n, n);
+    Matrix<double> u, b, v;
+    Workspace ws;
+    double flops = 8.0 / 3.0 * n * n * n;
+    runner.Run("bidiagonalize/" + std::to_string(n), flops,
+               [&] { Bidiagonalize(a, u, b, v, &ws); });
+}
+
+void BenchSVD(BenchmarkRunner& runner, std::size_t n) {
+    Matrix<double> a = RandomMatrix(n, n);
+    SVDDecomposition<double> svd;
+    Workspace ws;
+    runner.Run("svd/" + std::to_string(n), 0.0,
+               [&] { svd.Compute(a, &ws); });
+}
+
+}  // namespace
+
+// Usage: linalg_benchmarks [--max-size=N] [--json=PATH]
+//
+// The sweep runs 16 through 4096, doubling; --max-size trims the upper end
+// for quick local runs, and --json records results for CI to diff.
+int main(int argc, char** argv) {
+    std::size_t max_size = 4096;
+    std::string json_path;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg.rfind("--max-size=", 0) == 0) {
+            max_size = std::strtoull(arg.c_str() + 11, nullptr, 10);
+        } else if (arg.rfind("--json=", 0) == 0) {
+            json_path = arg.substr(7);
+        }
+    }
+
+    BenchmarkRunner runner;
+    for (std::size_t n = 16; n <= max_size; n *= 2) {
+        BenchGemm(runner, n);
+    }
+    for (std::size_t n = 16; n <= max_size; n *= 2) {
+        BenchQR(runner, n);
+    }
+    for (std::size_t n = 16; n <= max_size; n *= 2) {
+        BenchBidiagonalize(runner, n);
+    }
+    for (std::size_t n = 16; n <= max_size; n *= 2) {
+        BenchSVD(runner, n);
+    }
+
+    if (!json_path.empty()) {
+        runner.WriteJson(json_path);
+    }
+    return 0;
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace linalg::bench {
+
+struct BenchmarkResult {
+    std::string name;
+    std::size_t iterations = 0;
+    double ns_per_iteration = 0.0;
+    double gflops = 0.0;
+};
+
+// Minimal benchmark harness: each case is timed with an adaptive iteration
+// count (repeating until the wall time passes a floor, so fast kernels are
+// not measured in the noise), and results go to stdout as a table or to a
+// file as JSON for CI to diff across revisions.
+class BenchmarkRunner {
+public:
+    // flops is the work per iteration; pass 0 when a rate is meaningless.
+    void Run(const std::string& name, double flops,
+             const std::function<void()>& body) {
+        using Clock = std::chrono::steady_clock;
+        constexpr double kMinSeconds = 0.2;
+
+        // Warm-up: one untimed call to fill caches and thread pools.
+        body();
+
+        std::size_t iterations = 1;
+        double seconds = 0.0;
+        while (true) {
+            auto start = Clock::now();
+            for (std::size_t i = 0; i < iterations; ++i) {
+                body();
+            }
+            seconds = std::chrono::duration<double>(Clock::now() - start)
+                          .count();
+            if (seconds >= kMinSeconds || iterations >= (1u << 20)) {
+                break;
+            }
+            iterations *= 2;
+        }
+
+        BenchmarkResult result;
+        result.name = name;
+        result.iterations = iterations;
+        result.ns_per_iteration = seconds * 1e9 / iterations;
+        result.gflops =
+            flops > 0.0 ? flops * iterations / seconds / 1e9 : 0.0;
+        results_.push_back(result);
+
+        std::cout << name << ": " << result.ns_per_iteration << " ns/iter";
+        if (result.gflops > 0.0) {
+            std::cout << " (" << result.gflops << " GFLOP/s)";
+        }
+        std::cout << '\n';
+    }
+
+    // Writes every recorded result as a JSON array, mirroring the fields
+    // above so runs from different revisions diff cleanly.
+    void WriteJson(const std::string& path) const {
+        std::ofstream out(path);
+        out << "[\n";
+        for (std::size_t i = 0; i < results_.size(); ++i) {
+            const BenchmarkResult& r = results_[i];
+            out << "  {\"name\": \"" << r.name
+                << "\", \"iterations\": " << r.iterations
+                << ", \"ns_per_iteration\": " << r.ns_per_iteration
+                << ", \"gflops\": " << r.gflops << "}"
+                << (i + 1 == results_.size() ? "\n" : ",\n");
+        }
+        out << "]\n";
+    }
+
+    const std::vector<BenchmarkResult>& Results() const {
+        return results_;
+    }
+
+private:
+    std::vector<BenchmarkResult> results_;
+};
+
+}  // namespace linalg::bench
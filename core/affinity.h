@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstddef>
+#include <thread>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace linalg::numa {
+
+// Pins a thread to one CPU. Returns false where unsupported (non-Linux);
+// callers treat pinning as a best-effort hint.
+inline bool PinThreadToCpu(std::thread& thread, std::size_t cpu) {
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu % CPU_SETSIZE, &set);
+    return pthread_setaffinity_np(thread.native_handle(), sizeof(set),
+                                  &set) == 0;
+#else
+    (void)thread;
+    (void)cpu;
+    return false;
+#endif
+}
+
+}  // namespace linalg::numa
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+
+#include "affinity.h"
+#include "thread_pool.h"
+
+namespace linalg {
+
+// Placement policy for large matrix backing stores on multi-socket hosts.
+// Placement works through first touch: whichever core first writes a page
+// decides its NUMA node, so the policies differ only in which pool thread
+// touches which pages right after allocation. No libnuma dependency.
+enum class NumaPolicy {
+    kFirstTouch,   // no pre-touch; pages land wherever the caller writes
+    kInterleaved,  // pages round-robined across the pool threads
+    kPartitioned,  // contiguous page ranges, one per pool thread
+};
+
+namespace numa {
+
+// Allocations below this size skip the pre-touch: they fit one node's
+// cache hierarchy anyway and the ParallelFor dispatch would dominate.
+inline constexpr std::size_t kPreTouchMinBytes = std::size_t{4} << 20;
+inline constexpr std::size_t kPageSize = 4096;
+
+namespace detail {
+
+inline std::atomic<NumaPolicy>& PolicySlot() {
+    static std::atomic<NumaPolicy> policy{NumaPolicy::kFirstTouch};
+    return policy;
+}
+
+}  // namespace detail
+
+// Process-wide policy for subsequent large allocations. Set it once at
+// startup, after sizing (and ideally pinning) the global thread pool.
+inline void SetPolicy(NumaPolicy policy) {
+    detail::PolicySlot().store(policy, std::memory_order_relaxed);
+}
+
+inline NumaPolicy Policy() {
+    return detail::PolicySlot().load(std::memory_order_relaxed);
+}
+
+// Writes one zero per page from the pool threads according to the policy,
+// fixing each page's home node before the caller's own initialization
+// writes can. With pinned pool threads, kPartitioned gives each worker a
+// locally-resident contiguous slab and kInterleaved spreads pages evenly.
+inline void PreTouch(unsigned char* data, std::size_t bytes,
+                     NumaPolicy policy) {
+    std::size_t pages = (bytes + kPageSize - 1) / kPageSize;
+    ThreadPool& pool = ThreadPool::Global();
+    if (policy == NumaPolicy::kPartitioned) {
+        pool.ParallelFor(0, pages, 1,
+                         [&](std::size_t begin, std::size_t end) {
+                             for (std::size_t p = begin; p < end; ++p) {
+                                 data[p * kPageSize] = 0;
+                             }
+                         });
+    } else {
+        // One strided sweep per worker: worker w touches pages
+        // w, w + workers, w + 2 * workers, ...
+        std::size_t workers = pool.ThreadCount();
+        pool.ParallelFor(0, workers, 1,
+                         [&](std::size_t begin, std::size_t end) {
+                             for (std::size_t w = begin; w < end; ++w) {
+                                 for (std::size_t p = w; p < pages;
+                                      p += workers) {
+                                     data[p * kPageSize] = 0;
+                                 }
+                             }
+                         });
+    }
+}
+
+}  // namespace numa
+
+// Page-aligned allocator for matrix backing stores. Large allocations are
+// pre-touched by the pool threads under the active NUMA policy, so the
+// pages are already resident on the right nodes when the factorization
+// threads start hammering them. Stateless: policy is read per allocation.
+template <typename T>
+struct NumaAllocator {
+    using value_type = T;
+
+    NumaAllocator() = default;
+
+    template <typename U>
+    NumaAllocator(const NumaAllocator<U>&) {}
+
+    T* allocate(std::size_t count) {
+        std::size_t bytes = count * sizeof(T);
+        T* data = static_cast<T*>(
+            ::operator new(bytes, std::align_val_t{numa::kPageSize}));
+        NumaPolicy policy = numa::Policy();
+        if (policy != NumaPolicy::kFirstTouch &&
+            bytes >= numa::kPreTouchMinBytes) {
+            numa::PreTouch(reinterpret_cast<unsigned char*>(data), bytes,
+                           policy);
+        }
+        return data;
+    }
+
+    void deallocate(T* data, std::size_t) {
+        ::operator delete(data, std::align_val_t{numa::kPageSize});
+    }
+
+    template <typename U>
+    bool operator==(const NumaAllocator<U>&) const {
+        return true;
+    }
+};
+
+}  // namespace linalg
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace linalg {
+
+// Compile-time switch for the instrumentation below. Off by default: every
+// counter bump and timer collapses to nothing, so the hot loops carry zero
+// cost. Build with -DLINALG_ENABLE_PERF to record; the recording itself is
+// a relaxed add or two clock reads per phase, cheap enough to leave on for
+// sampled production calls.
+#if defined(LINALG_ENABLE_PERF)
+inline constexpr bool kPerfEnabled = true;
+#else
+inline constexpr bool kPerfEnabled = false;
+#endif
+
+// Counters and per-phase wall times one decomposition call accumulated.
+// Drivers expose it via Perf(); fields a driver has no notion of (e.g.
+// sweeps for plain QR) simply stay zero. All values are zero when the
+// instrumentation is compiled out.
+struct PerfReport {
+    std::uint64_t reflectors = 0;   // Householder reflectors applied
+    std::uint64_t sweeps = 0;       // iteration steps on the reduced form
+    std::uint64_t deflations = 0;   // block splits / converged entries
+    std::uint64_t flops = 0;        // floating-point operation estimate
+    std::uint64_t scratch_bytes = 0;  // workspace arena growth this call
+
+    double reduce_seconds = 0.0;       // reduction to condensed form
+    double iterate_seconds = 0.0;      // iteration on the condensed form
+    double factor_seconds = 0.0;       // direct factorization phase
+    double materialize_seconds = 0.0;  // on-demand factor assembly
+
+    void Reset() {
+        *this = PerfReport{};
+    }
+};
+
+namespace perf {
+
+// Relaxed atomic add: deflated blocks iterate concurrently and bump the
+// same report, and a plain += would tear. Uncontended it is one locked add.
+inline void Add(std::uint64_t& counter, std::uint64_t value) {
+    if constexpr (kPerfEnabled) {
+        std::atomic_ref<std::uint64_t>(counter).fetch_add(
+            value, std::memory_order_relaxed);
+    } else {
+        (void)counter;
+        (void)value;
+    }
+}
+
+// Accumulates the wall time of its scope into a PerfReport field. The
+// disabled variant is an empty object the optimizer deletes outright.
+#if defined(LINALG_ENABLE_PERF)
+class ScopedTimer {
+public:
+    explicit ScopedTimer(double& sink)
+        : sink_(&sink), start_(std::chrono::steady_clock::now()) {}
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+    ~ScopedTimer() {
+        *sink_ += std::chrono::duration<double>(
+                      std::chrono::steady_clock::now() - start_)
+                      .count();
+    }
+
+private:
+    double* sink_;
+    std::chrono::steady_clock::time_point start_;
+};
+#else
+class ScopedTimer {
+public:
+    explicit ScopedTimer(double&) {}
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+};
+#endif
+
+}  // namespace perf
+
+}  // namespace linalg
@@ -0,0 +1,265 @@
+#pragma once
+
+#include <cstddef>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+namespace linalg::simd {
+
+// Instruction sets the dispatching kernels can target. Detection happens once
+// per process; the result is cached inside each dispatching wrapper.
+enum class IsaLevel {
+    kScalar,
+    kAvx2,
+    kAvx512,
+};
+
+inline IsaLevel DetectIsaLevel() {
+#if defined(__x86_64__)
+    if (__builtin_cpu_supports("avx512f")) {
+        return IsaLevel::kAvx512;
+    }
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+        return IsaLevel::kAvx2;
+    }
+#endif
+    return IsaLevel::kScalar;
+}
+
+namespace detail {
+
+template <typename T>
+void AxpyScalar(T a, const T* x, T* y, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        y[i] += a * x[i];
+    }
+}
+
+template <typename T>
+T DotScalar(const T* x, const T* y, std::size_t n) {
+    T sum{};
+    for (std::size_t i = 0; i < n; ++i) {
+        sum += x[i] * y[i];
+    }
+    return sum;
+}
+
+#if defined(__x86_64__)
+
+__attribute__((target("avx2,fma"))) inline void AxpyAvx2(double a,
+                                                         const double* x,
+                                                         double* y,
+                                                         std::size_t n) {
+    __m256d va = _mm256_set1_pd(a);
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256d vy = _mm256_loadu_pd(y + i);
+        vy = _mm256_fmadd_pd(va, _mm256_loadu_pd(x + i), vy);
+        _mm256_storeu_pd(y + i, vy);
+    }
+    for (; i < n; ++i) {
+        y[i] += a * x[i];
+    }
+}
+
+__attribute__((target("avx2,fma"))) inline void AxpyAvx2(float a,
+                                                         const float* x,
+                                                         float* y,
+                                                         std::size_t n) {
+    __m256 va = _mm256_set1_ps(a);
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 vy = _mm256_loadu_ps(y + i);
+        vy = _mm256_fmadd_ps(va, _mm256_loadu_ps(x + i), vy);
+        _mm256_storeu_ps(y + i, vy);
+    }
+    for (; i < n; ++i) {
+        y[i] += a * x[i];
+    }
+}
+
+__attribute__((target("avx512f"))) inline void AxpyAvx512(double a,
+                                                          const double* x,
+                                                          double* y,
+                                                          std::size_t n) {
+    __m512d va = _mm512_set1_pd(a);
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m512d vy = _mm512_loadu_pd(y + i);
+        vy = _mm512_fmadd_pd(va, _mm512_loadu_pd(x + i), vy);
+        _mm512_storeu_pd(y + i, vy);
+    }
+    if (i < n) {
+        __mmask8 mask = (1u << (n - i)) - 1;
+        __m512d vy = _mm512_maskz_loadu_pd(mask, y + i);
+        __m512d vx = _mm512_maskz_loadu_pd(mask, x + i);
+        _mm512_mask_storeu_pd(y + i, mask, _mm512_fmadd_pd(va, vx, vy));
+    }
+}
+
+__attribute__((target("avx512f"))) inline void AxpyAvx512(float a,
+                                                          const float* x,
+                                                          float* y,
+                                                          std::size_t n) {
+    __m512 va = _mm512_set1_ps(a);
+    std::size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m512 vy = _mm512_loadu_ps(y + i);
+        vy = _mm512_fmadd_ps(va, _mm512_loadu_ps(x + i), vy);
+        _mm512_storeu_ps(y + i, vy);
+    }
+    if (i < n) {
+        __mmask16 mask = (1u << (n - i)) - 1;
+        __m512 vy = _mm512_maskz_loadu_ps(mask, y + i);
+        __m512 vx = _mm512_maskz_loadu_ps(mask, x + i);
+        _mm512_mask_storeu_ps(y + i, mask, _mm512_fmadd_ps(va, vx, vy));
+    }
+}
+
+__attribute__((target("avx2,fma"))) inline double DotAvx2(const double* x,
+                                                          const double* y,
+                                                          std::size_t n) {
+    __m256d acc = _mm256_setzero_pd();
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        acc = _mm256_fmadd_pd(_mm256_loadu_pd(x + i), _mm256_loadu_pd(y + i),
+                              acc);
+    }
+    alignas(32) double lanes[4];
+    _mm256_store_pd(lanes, acc);
+    double sum = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    for (; i < n; ++i) {
+        sum += x[i] * y[i];
+    }
+    return sum;
+}
+
+__attribute__((target("avx2,fma"))) inline float DotAvx2(const float* x,
+                                                         const float* y,
+                                                         std::size_t n) {
+    __m256 acc = _mm256_setzero_ps();
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        acc = _mm256_fmadd_ps(_mm256_loadu_ps(x + i), _mm256_loadu_ps(y + i),
+                              acc);
+    }
+    alignas(32) float lanes[8];
+    _mm256_store_ps(lanes, acc);
+    float sum = 0.0f;
+    for (float lane : lanes) {
+        sum += lane;
+    }
+    for (; i < n; ++i) {
+        sum += x[i] * y[i];
+    }
+    return sum;
+}
+
+__attribute__((target("avx512f"))) inline double DotAvx512(const double* x,
+                                                           const double* y,
+                                                           std::size_t n) {
+    __m512d acc = _mm512_setzero_pd();
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        acc = _mm512_fmadd_pd(_mm512_loadu_pd(x + i), _mm512_loadu_pd(y + i),
+                              acc);
+    }
+    double sum = _mm512_reduce_add_pd(acc);
+    for (; i < n; ++i) {
+        sum += x[i] * y[i];
+    }
+    return sum;
+}
+
+__attribute__((target("avx512f"))) inline float DotAvx512(const float* x,
+                                                          const float* y,
+                                                          std::size_t n) {
+    __m512 acc = _mm512_setzero_ps();
+    std::size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        acc = _mm512_fmadd_ps(_mm512_loadu_ps(x + i), _mm512_loadu_ps(y + i),
+                              acc);
+    }
+    float sum = _mm512_reduce_add_ps(acc);
+    for (; i < n; ++i) {
+        sum += x[i] * y[i];
+    }
+    return sum;
+}
+
+#endif  // defined(__x86_64__)
+
+}  // namespace detail
+
+// y[0..n) += a * x[0..n). Float and double get the widest kernel the host
+// CPU supports; every other element type falls through to the scalar loop.
+template <typename T>
+void Axpy(T a, const T* x, T* y, std::size_t n) {
+    detail::AxpyScalar(a, x, y, n);
+}
+
+inline void Axpy(double a, const double* x, double* y, std::size_t n) {
+#if defined(__x86_64__)
+    static const IsaLevel level = DetectIsaLevel();
+    if (level == IsaLevel::kAvx512) {
+        detail::AxpyAvx512(a, x, y, n);
+        return;
+    }
+    if (level == IsaLevel::kAvx2) {
+        detail::AxpyAvx2(a, x, y, n);
+        return;
+    }
+#endif
+    detail::AxpyScalar(a, x, y, n);
+}
+
+inline void Axpy(float a, const float* x, float* y, std::size_t n) {
+#if defined(__x86_64__)
+    static const IsaLevel level = DetectIsaLevel();
+    if (level == IsaLevel::kAvx512) {
+        detail::AxpyAvx512(a, x, y, n);
+        return;
+    }
+    if (level == IsaLevel::kAvx2) {
+        detail::AxpyAvx2(a, x, y, n);
+        return;
+    }
+#endif
+    detail::AxpyScalar(a, x, y, n);
+}
+
+// Returns the inner product of x and y over n elements.
+template <typename T>
+T Dot(const T* x, const T* y, std::size_t n) {
+    return detail::DotScalar(x, y, n);
+}
+
+inline double Dot(const double* x, const double* y, std::size_t n) {
+#if defined(__x86_64__)
+    static const IsaLevel level = DetectIsaLevel();
+    if (level == IsaLevel::kAvx512) {
+        return detail::DotAvx512(x, y, n);
+    }
+    if (level == IsaLevel::kAvx2) {
+        return detail::DotAvx2(x, y, n);
+    }
+#endif
+    return detail::DotScalar(x, y, n);
+}
+
+inline float Dot(const float* x, const float* y, std::size_t n) {
+#if defined(__x86_64__)
+    static const IsaLevel level = DetectIsaLevel();
+    if (level == IsaLevel::kAvx512) {
+        return detail::DotAvx512(x, y, n);
+    }
+    if (level == IsaLevel::kAvx2) {
+        return detail::DotAvx2(x, y, n);
+    }
+#endif
+    return detail::DotScalar(x, y, n);
+}
+
+}  // namespace linalg::simd
@@ -0,0 +1,255 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "affinity.h"
+
+namespace linalg {
+
+// Work-stealing task scheduler for irregular workloads. Unlike
+// ThreadPool::ParallelFor, which carves a known range into equal chunks up
+// front, tasks here land on per-thread deques: a worker runs its own newest
+// task first (depth-first, cache-warm) and steals the oldest task of a
+// random victim when its own deque drains (breadth-first, big subtrees
+// move first). Recursive drivers whose subproblem sizes are only discovered
+// as they split — deflation trees, blocked factorizations — stay load-
+// balanced this way even when one branch is 10x its siblings.
+//
+// Structured use goes through TaskGroup: Spawn hands a subproblem to the
+// scheduler, Wait blocks until every spawned task of the group finished.
+// Wait helps execute queued tasks while it blocks, so nested groups on
+// worker threads cannot deadlock the pool.
+class TaskScheduler {
+public:
+    explicit TaskScheduler(std::size_t thread_count = 0) {
+        if (thread_count == 0) {
+            thread_count = std::thread::hardware_concurrency();
+            if (thread_count == 0) {
+                thread_count = 1;
+            }
+        }
+        queues_.resize(thread_count);
+        for (auto& queue : queues_) {
+            queue = std::make_unique<Queue>();
+        }
+        workers_.reserve(queues_.size());
+        for (std::size_t i = 0; i < queues_.size(); ++i) {
+            workers_.emplace_back([this, i] { WorkerLoop(i); });
+        }
+    }
+
+    ~TaskScheduler() {
+        {
+            std::lock_guard<std::mutex> lock(sleep_mutex_);
+            stop_ = true;
+        }
+        sleep_cv_.notify_all();
+        for (auto& worker : workers_) {
+            worker.join();
+        }
+    }
+
+    TaskScheduler(const TaskScheduler&) = delete;
+    TaskScheduler& operator=(const TaskScheduler&) = delete;
+
+    std::size_t ThreadCount() const {
+        return workers_.size();
+    }
+
+    // Same contract as ThreadPool::PinThreads: worker i goes to CPU
+    // i * stride, best effort. Pinned workers keep stealing, but their own
+    // deque's tasks run on a stable core, so panel data stays node-local.
+    std::size_t PinThreads(std::size_t stride = 1) {
+        std::size_t pinned = 0;
+        for (std::size_t i = 0; i < workers_.size(); ++i) {
+            if (numa::PinThreadToCpu(workers_[i], i * stride)) {
+                ++pinned;
+            }
+        }
+        return pinned;
+    }
+
+    // Lazily created process-wide scheduler, sized to the hardware.
+    static TaskScheduler& Global() {
+        std::lock_guard<std::mutex> lock(GlobalMutex());
+        auto& scheduler = GlobalSlot();
+        if (!scheduler) {
+            scheduler = std::make_unique<TaskScheduler>();
+        }
+        return *scheduler;
+    }
+
+    // Replaces the global scheduler. Must not be called while tasks are in
+    // flight.
+    static void SetGlobalThreadCount(std::size_t thread_count) {
+        std::lock_guard<std::mutex> lock(GlobalMutex());
+        GlobalSlot() = std::make_unique<TaskScheduler>(thread_count);
+    }
+
+    class TaskGroup {
+    public:
+        explicit TaskGroup(TaskScheduler& scheduler = Global())
+            : scheduler_(scheduler) {}
+
+        ~TaskGroup() {
+            Wait();
+        }
+
+        TaskGroup(const TaskGroup&) = delete;
+        TaskGroup& operator=(const TaskGroup&) = delete;
+
+        void Spawn(std::function<void()> task) {
+            pending_.fetch_add(1, std::memory_order_relaxed);
+            scheduler_.Enqueue([this, task = std::move(task)] {
+                task();
+                pending_.fetch_sub(1, std::memory_order_release);
+            });
+        }
+
+        // Blocks until every task spawned on this group has finished,
+        // executing queued tasks (not necessarily this group's) meanwhile.
+        void Wait() {
+            while (pending_.load(std::memory_order_acquire) != 0) {
+                if (!scheduler_.RunOne()) {
+                    std::this_thread::yield();
+                }
+            }
+        }
+
+    private:
+        TaskScheduler& scheduler_;
+        std::atomic<std::size_t> pending_{0};
+    };
+
+private:
+    using Task = std::function<void()>;
+
+    // One deque per worker behind its own mutex: the owner pushes and pops
+    // at the back, thieves take from the front. Contention is limited to
+    // steal attempts, which only happen when a deque has drained.
+    struct Queue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    // The worker index of the calling thread on *this* scheduler.
+    // tls_worker_index_ is only meaningful for the instance that set it; a
+    // worker of one scheduler touching another (e.g. a task spawning onto
+    // Global() from a private scheduler's thread) must take the external
+    // path or it would index the wrong deque array.
+    std::size_t LocalWorkerIndex() const {
+        return tls_owner_ == this ? tls_worker_index_ : kExternalThread;
+    }
+
+    void Enqueue(Task task) {
+        std::size_t self = LocalWorkerIndex();
+        std::size_t index = self != kExternalThread
+                                ? self
+                                : next_external_.fetch_add(
+                                      1, std::memory_order_relaxed) %
+                                      queues_.size();
+        {
+            std::lock_guard<std::mutex> lock(queues_[index]->mutex);
+            queues_[index]->tasks.push_back(std::move(task));
+        }
+        sleep_cv_.notify_one();
+    }
+
+    // Runs one task if any is available: the current worker's own deque
+    // first (newest task), then a sweep over the other deques (oldest
+    // task). Returns false when every deque was empty.
+    bool RunOne() {
+        std::size_t self = LocalWorkerIndex();
+        Task task;
+        if (self != kExternalThread && PopOwn(self, task)) {
+            task();
+            return true;
+        }
+        std::size_t count = queues_.size();
+        std::size_t start = self != kExternalThread ? self + 1 : 0;
+        for (std::size_t offset = 0; offset < count; ++offset) {
+            std::size_t victim = (start + offset) % count;
+            if (victim == self) {
+                continue;
+            }
+            if (Steal(victim, task)) {
+                task();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool PopOwn(std::size_t index, Task& task) {
+        std::lock_guard<std::mutex> lock(queues_[index]->mutex);
+        if (queues_[index]->tasks.empty()) {
+            return false;
+        }
+        task = std::move(queues_[index]->tasks.back());
+        queues_[index]->tasks.pop_back();
+        return true;
+    }
+
+    bool Steal(std::size_t victim, Task& task) {
+        std::lock_guard<std::mutex> lock(queues_[victim]->mutex);
+        if (queues_[victim]->tasks.empty()) {
+            return false;
+        }
+        task = std::move(queues_[victim]->tasks.front());
+        queues_[victim]->tasks.pop_front();
+        return true;
+    }
+
+    void WorkerLoop(std::size_t index) {
+        tls_worker_index_ = index;
+        tls_owner_ = this;
+        while (true) {
+            if (RunOne()) {
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(sleep_mutex_);
+            if (stop_) {
+                return;
+            }
+            sleep_cv_.wait_for(lock, std::chrono::milliseconds(1));
+        }
+    }
+
+    static std::mutex& GlobalMutex() {
+        static std::mutex mutex;
+        return mutex;
+    }
+
+    static std::unique_ptr<TaskScheduler>& GlobalSlot() {
+        static std::unique_ptr<TaskScheduler> scheduler;
+        return scheduler;
+    }
+
+    static constexpr std::size_t kExternalThread =
+        static_cast<std::size_t>(-1);
+    static thread_local std::size_t tls_worker_index_;
+    static thread_local TaskScheduler* tls_owner_;
+
+    std::vector<std::unique_ptr<Queue>> queues_;
+    std::vector<std::thread> workers_;
+    std::atomic<std::size_t> next_external_{0};
+    std::mutex sleep_mutex_;
+    std::condition_variable sleep_cv_;
+    bool stop_ = false;
+};
+
+inline thread_local std::size_t TaskScheduler::tls_worker_index_ =
+    TaskScheduler::kExternalThread;
+inline thread_local TaskScheduler* TaskScheduler::tls_owner_ = nullptr;
+
+}  // namespace linalg
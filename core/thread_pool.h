@@ -0,0 +1,183 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+#include "affinity.h"
+
+namespace linalg {
+
+// Library-owned pool of worker threads, reused across decomposition calls so
+// thread startup never sits on the hot path. The pool is created lazily on
+// first use; callers that want a specific size set it up front through
+// ThreadPool::SetGlobalThreadCount.
+class ThreadPool {
+public:
+    explicit ThreadPool(std::size_t thread_count = 0) {
+        if (thread_count == 0) {
+            thread_count = std::thread::hardware_concurrency();
+            if (thread_count == 0) {
+                thread_count = 1;
+            }
+        }
+        workers_.reserve(thread_count);
+        for (std::size_t i = 0; i < thread_count; ++i) {
+            workers_.emplace_back([this] { WorkerLoop(); });
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        wake_.notify_all();
+        for (auto& worker : workers_) {
+            worker.join();
+        }
+    }
+
+    std::size_t ThreadCount() const {
+        return workers_.size();
+    }
+
+    // Pins worker i to CPU i * stride, spreading the pool across cores (or
+    // across sockets with a stride matching the per-socket core count), so
+    // first-touched pages stay local to the worker that uses them. Returns
+    // the number of threads actually pinned; zero on platforms without
+    // affinity support.
+    std::size_t PinThreads(std::size_t stride = 1) {
+        std::size_t pinned = 0;
+        for (std::size_t i = 0; i < workers_.size(); ++i) {
+            if (numa::PinThreadToCpu(workers_[i], i * stride)) {
+                ++pinned;
+            }
+        }
+        return pinned;
+    }
+
+    void Submit(std::function<void()> task) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            tasks_.push(std::move(task));
+        }
+        wake_.notify_one();
+    }
+
+    // Runs body(chunk_begin, chunk_end) over [begin, end) split into chunks of
+    // at least grain iterations. The calling thread executes the final chunk
+    // itself, then helps drain the queue until every chunk has finished.
+    // Helping (rather than sleeping on a condition variable) is what makes
+    // nesting safe: concurrent callers whose chunk bodies issue their own
+    // ParallelFor can otherwise occupy every worker with outer chunks that
+    // all wait on queued inner ones no thread is left to run. Ranges too
+    // small to fill more than one chunk run inline without touching the
+    // queue.
+    void ParallelFor(std::size_t begin, std::size_t end, std::size_t grain,
+                     const std::function<void(std::size_t, std::size_t)>& body) {
+        if (begin >= end) {
+            return;
+        }
+        std::size_t range = end - begin;
+        std::size_t chunks = std::min(workers_.size(),
+                                      (range + grain - 1) / grain);
+        if (chunks <= 1) {
+            body(begin, end);
+            return;
+        }
+
+        std::size_t chunk_size = (range + chunks - 1) / chunks;
+        std::atomic<std::size_t> remaining{chunks - 1};
+
+        for (std::size_t c = 0; c + 1 < chunks; ++c) {
+            std::size_t chunk_begin = begin + c * chunk_size;
+            std::size_t chunk_end = std::min(chunk_begin + chunk_size, end);
+            Submit([&, chunk_begin, chunk_end] {
+                body(chunk_begin, chunk_end);
+                remaining.fetch_sub(1, std::memory_order_acq_rel);
+            });
+        }
+        body(begin + (chunks - 1) * chunk_size, end);
+
+        // The drained tasks may belong to any caller, not just this loop;
+        // running them is always progress (TaskGroup::Wait follows the
+        // same discipline).
+        while (remaining.load(std::memory_order_acquire) != 0) {
+            std::function<void()> task;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (!tasks_.empty()) {
+                    task = std::move(tasks_.front());
+                    tasks_.pop();
+                }
+            }
+            if (task) {
+                task();
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    static ThreadPool& Global() {
+        std::lock_guard<std::mutex> lock(GlobalMutex());
+        auto& pool = GlobalSlot();
+        if (!pool) {
+            pool = std::make_unique<ThreadPool>();
+        }
+        return *pool;
+    }
+
+    // Replaces the global pool. Must not be called while a decomposition is
+    // running on it.
+    static void SetGlobalThreadCount(std::size_t thread_count) {
+        std::lock_guard<std::mutex> lock(GlobalMutex());
+        GlobalSlot() = std::make_unique<ThreadPool>(thread_count);
+    }
+
+private:
+    void WorkerLoop() {
+        while (true) {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                wake_.wait(lock,
+                           [this] { return stopping_ || !tasks_.empty(); });
+                if (stopping_ && tasks_.empty()) {
+                    return;
+                }
+                task = std::move(tasks_.front());
+                tasks_.pop();
+            }
+            task();
+        }
+    }
+
+    static std::mutex& GlobalMutex() {
+        static std::mutex mutex;
+        return mutex;
+    }
+
+    static std::unique_ptr<ThreadPool>& GlobalSlot() {
+        static std::unique_ptr<ThreadPool> pool;
+        return pool;
+    }
+
+    std::vector<std::thread> workers_;
+    std::queue<std::function<void()>> tasks_;
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    bool stopping_ = false;
+};
+
+}  // namespace linalg
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace linalg {
+
+// Arena-style scratch allocator for decomposition internals. Memory is taken
+// from geometrically grown blocks and handed out by bumping an offset; blocks
+// are never returned to the heap, so after a warm-up call every subsequent
+// decomposition of the same shape performs zero heap allocations. Allocations
+// are 64-byte aligned and must hold trivially destructible types.
+//
+// Reset() rewinds the whole arena; Mark()/Rewind() bracket a short-lived
+// allocation without disturbing anything allocated before the mark.
+class Workspace {
+public:
+    struct Marker {
+        std::size_t block = 0;
+        std::size_t used = 0;
+    };
+
+    Workspace() = default;
+    Workspace(const Workspace&) = delete;
+    Workspace& operator=(const Workspace&) = delete;
+
+    template <typename T>
+    T* Allocate(std::size_t count) {
+        static_assert(std::is_trivially_destructible_v<T>,
+                      "Workspace memory is never destructed");
+        std::size_t bytes = (count * sizeof(T) + kAlignment - 1) /
+                            kAlignment * kAlignment;
+        while (active_ < blocks_.size() &&
+               blocks_[active_].used + bytes > blocks_[active_].size) {
+            ++active_;
+        }
+        if (active_ == blocks_.size()) {
+            std::size_t block_size = blocks_.empty()
+                                         ? kMinBlockSize
+                                         : blocks_.back().size * 2;
+            while (block_size < bytes) {
+                block_size *= 2;
+            }
+            blocks_.push_back(Block{AlignedBuffer(block_size), block_size, 0});
+        }
+        Block& block = blocks_[active_];
+        T* result = reinterpret_cast<T*>(block.data.get() + block.used);
+        block.used += bytes;
+        return result;
+    }
+
+    void Reset() {
+        for (Block& block : blocks_) {
+            block.used = 0;
+        }
+        active_ = 0;
+    }
+
+    Marker Mark() const {
+        return Marker{active_,
+                      active_ < blocks_.size() ? blocks_[active_].used : 0};
+    }
+
+    void Rewind(Marker marker) {
+        assert(marker.block <= active_);
+        for (std::size_t i = marker.block + 1; i < blocks_.size(); ++i) {
+            blocks_[i].used = 0;
+        }
+        if (marker.block < blocks_.size()) {
+            blocks_[marker.block].used = marker.used;
+        }
+        active_ = marker.block;
+    }
+
+    std::size_t CapacityBytes() const {
+        std::size_t total = 0;
+        for (const Block& block : blocks_) {
+            total += block.size;
+        }
+        return total;
+    }
+
+private:
+    static constexpr std::size_t kAlignment = 64;
+    static constexpr std::size_t kMinBlockSize = 4096;
+
+    struct Deleter {
+        void operator()(unsigned char* p) const {
+            ::operator delete[](p, std::align_val_t{kAlignment});
+        }
+    };
+
+    using Buffer = std::unique_ptr<unsigned char[], Deleter>;
+
+    static Buffer AlignedBuffer(std::size_t size) {
+        return Buffer(static_cast<unsigned char*>(
+            ::operator new[](size, std::align_val_t{kAlignment})));
+    }
+
+    struct Block {
+        Buffer data;
+        std::size_t size = 0;
+        std::size_t used = 0;
+    };
+
+    std::vector<Block> blocks_;
+    std::size_t active_ = 0;
+};
+
+}  // namespace linalg
@@ -0,0 +1,73 @@
+#include <iostream>
+#include <span>
+#include <vector>
+
+#include "../algorithms/batched.h"
+#include "test_helpers.h"
+
+using namespace linalg;
+using namespace linalg::tests;
+
+namespace {
+
+void TestBatchContainer() {
+    MatrixBatch<double> batch(5, 4, 3);
+    AssertTrue(batch.Size() == 5 && batch.Rows() == 4 && batch.Cols() == 3,
+               "batch dimensions");
+
+    batch[2](1, 2) = 7.0;
+    AssertNear(batch.Data()[2 * 12 + 1 * 3 + 2], 7.0, 0.0,
+               "batch storage is contiguous and matrix-major");
+}
+
+void TestBatchedSVD() {
+    std::vector<Matrix<double>> matrices;
+    for (int i = 0; i < 40; ++i) {
+        matrices.push_back(RandomMatrix(6, 6));
+    }
+
+    auto results = BatchedSVD(std::span<const Matrix<double>>(matrices));
+    AssertTrue(results.size() == matrices.size(),
+               "one SVD result per input");
+
+    for (std::size_t i = 0; i < matrices.size(); ++i) {
+        Matrix<double> sigma(6, 6);
+        for (std::size_t k = 0; k < 6; ++k) {
+            sigma(k, k) = results[i].singular_values[k];
+        }
+        AssertMatrixNear(
+            results[i].u * sigma * results[i].v.Transpose(), matrices[i],
+            1e-9, "batched SVD reconstructs each input");
+    }
+}
+
+void TestBatchedQROnBatchContainer() {
+    MatrixBatch<double> batch(25, 8, 5);
+    for (std::size_t i = 0; i < batch.Size(); ++i) {
+        Matrix<double> random = RandomMatrix(8, 5);
+        MatrixView<double> slot = batch[i];
+        for (std::size_t r = 0; r < 8; ++r) {
+            for (std::size_t c = 0; c < 5; ++c) {
+                slot(r, c) = random(r, c);
+            }
+        }
+    }
+
+    auto results = BatchedQR(batch);
+    for (std::size_t i = 0; i < batch.Size(); ++i) {
+        Matrix<double> original = batch[i];
+        AssertMatrixNear(results[i].q * results[i].r, original, 1e-10,
+                         "batched QR reconstructs each input");
+    }
+}
+
+}  // namespace
+
+int main() {
+    ThreadPool::SetGlobalThreadCount(4);
+    TestBatchContainer();
+    TestBatchedSVD();
+    TestBatchedQROnBatchContainer();
+    std::cout << "test_batched: OK\n";
+    return 0;
+}
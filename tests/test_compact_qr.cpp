@@ -0,0 +1,65 @@
+#include <iostream>
+#include <type_traits>
+
+#include "../algorithms/qr_decomposition.h"
+#include "test_helpers.h"
+
+using namespace linalg;
+using namespace linalg::tests;
+
+static_assert(std::is_nothrow_move_constructible_v<Matrix<double>>,
+              "Matrix move construction must be noexcept");
+static_assert(std::is_nothrow_move_assignable_v<Matrix<double>>,
+              "Matrix move assignment must be noexcept");
+
+namespace {
+
+void TestMoveAdoptsStorage() {
+    Matrix<double> a = RandomMatrix(10, 10);
+    const double* storage = a.Data();
+    Matrix<double> b = std::move(a);
+    AssertTrue(b.Data() == storage, "move adopts the source storage");
+    AssertTrue(a.Rows() == 0 && a.Cols() == 0, "moved-from matrix is empty");
+}
+
+void TestCompactMatchesFull() {
+    Matrix<double> a = RandomMatrix(30, 18);
+
+    QRDecomposition<double> full;
+    full.Compute(a);
+
+    QRDecomposition<double> compact;
+    compact.ComputeCompact(a);
+
+    AssertMatrixNear(compact.ExtractR(), full.R(), 1e-12,
+                     "compact R matches the full driver");
+    AssertMatrixNear(compact.MaterializeQ(), full.Q(), 1e-12,
+                     "materialized Q matches the full driver");
+    AssertMatrixNear(compact.MaterializeQ() * compact.ExtractR(), a, 1e-10,
+                     "compact factorization reconstructs A");
+}
+
+void TestMoveInCompute() {
+    Matrix<double> a = RandomMatrix(20, 20);
+    Matrix<double> copy = a;
+
+    QRDecomposition<double> qr;
+    qr.Compute(std::move(copy));
+    AssertTrue(copy.Rows() == 0, "rvalue Compute consumes the input");
+    AssertMatrixNear(qr.Q() * qr.R(), a, 1e-10,
+                     "move-in Compute factors correctly");
+
+    Matrix<double> q = qr.TakeQ();
+    AssertMatrixNear(q * q.Transpose(), Matrix<double>::Identity(20), 1e-10,
+                     "TakeQ moves out a valid orthogonal factor");
+}
+
+}  // namespace
+
+int main() {
+    TestMoveAdoptsStorage();
+    TestCompactMatchesFull();
+    TestMoveInCompute();
+    std::cout << "test_compact_qr: OK\n";
+    return 0;
+}
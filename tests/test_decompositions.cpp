@@ -0,0 +1,228 @@
+#include <cmath>
+#include <iostream>
+#include <numeric>
+#include <vector>
+
+#include "../algorithms/bidiagonalization.h"
+#include "../algorithms/givens.h"
+#include "../algorithms/qr_decomposition.h"
+#include "../algorithms/randomized_svd.h"
+#include "../algorithms/svd.h"
+#include "../core/thread_pool.h"
+#include "test_helpers.h"
+
+using namespace linalg;
+using namespace linalg::tests;
+
+namespace {
+
+void AssertOrthogonal(const Matrix<double>& q, const char* what) {
+    AssertMatrixNear(q * q.Transpose(),
+                     Matrix<double>::Identity(q.Rows()), 1e-10, what);
+}
+
+void TestParallelFor() {
+    std::vector<int> hits(1000, 0);
+    ThreadPool::Global().ParallelFor(0, hits.size(), 16,
+                                     [&](std::size_t begin, std::size_t end) {
+                                         for (std::size_t i = begin; i < end;
+                                              ++i) {
+                                             hits[i] += 1;
+                                         }
+                                     });
+    int total = std::accumulate(hits.begin(), hits.end(), 0);
+    AssertTrue(total == 1000, "ParallelFor covers the range exactly once");
+}
+
+void TestQR() {
+    for (auto [m, n] : {std::pair<std::size_t, std::size_t>{30, 30},
+                        {50, 20},
+                        {20, 45}}) {
+        Matrix<double> a = RandomMatrix(m, n);
+        QRDecomposition<double> qr;
+        qr.Compute(a);
+
+        AssertOrthogonal(qr.Q(), "Q is orthogonal");
+        AssertMatrixNear(qr.Q() * qr.R(), a, 1e-10, "Q * R reconstructs A");
+        for (std::size_t i = 0; i < m; ++i) {
+            for (std::size_t j = 0; j < std::min(i, n); ++j) {
+                AssertNear(qr.R()(i, j), 0.0, 1e-12,
+                           "R is upper triangular");
+            }
+        }
+    }
+}
+
+void TestBidiagonalization() {
+    for (auto [m, n] : {std::pair<std::size_t, std::size_t>{25, 25},
+                        {40, 15}}) {
+        Matrix<double> a = RandomMatrix(m, n);
+        Matrix<double> u, b, v;
+        Bidiagonalize(a, u, b, v);
+
+        AssertOrthogonal(u, "U is orthogonal");
+        AssertOrthogonal(v, "V is orthogonal");
+        AssertMatrixNear(u * b * v.Transpose(), a, 1e-10,
+                         "U * B * V^T reconstructs A");
+        for (std::size_t i = 0; i < m; ++i) {
+            for (std::size_t j = 0; j < n; ++j) {
+                if (j != i && j != i + 1) {
+                    AssertNear(b(i, j), 0.0, 1e-12, "B is upper bidiagonal");
+                }
+            }
+        }
+    }
+}
+
+// A fused rotation wave must produce exactly what applying the rotations one
+// at a time produces.
+void TestGivensWaveMatchesSequential() {
+    Matrix<double> a = RandomMatrix(40, 12);
+    Matrix<double> expected = a;
+
+    GivensWave<double> wave;
+    wave.Reset(2);
+    for (std::size_t i = 0; i < 8; ++i) {
+        GivensRotation<double> g =
+            ComputeGivens(0.3 + 0.1 * i, 0.9 - 0.05 * i);
+        wave.Append(g);
+        ApplyGivensRight(expected, g.c, g.s, 2 + i, 3 + i);
+    }
+
+    ApplyGivensWaveRight(a, wave);
+    AssertMatrixNear(a, expected, 1e-14,
+                     "fused Givens wave matches sequential application");
+}
+
+void TestSVD() {
+    for (auto [m, n] : {std::pair<std::size_t, std::size_t>{20, 20},
+                        {35, 12},
+                        {12, 35}}) {
+        Matrix<double> a = RandomMatrix(m, n);
+        SVDDecomposition<double> svd;
+        svd.Compute(a);
+
+        AssertOrthogonal(svd.U(), "U is orthogonal");
+        AssertOrthogonal(svd.V(), "V is orthogonal");
+        AssertMatrixNear(svd.U() * svd.SigmaMatrix() * svd.V().Transpose(),
+                         a, 1e-9, "U * S * V^T reconstructs A");
+
+        const auto& sigma = svd.SingularValues();
+        AssertTrue(sigma.size() == std::min(m, n),
+                   "one singular value per rank slot");
+        for (std::size_t i = 0; i + 1 < sigma.size(); ++i) {
+            AssertTrue(sigma[i] >= sigma[i + 1],
+                       "singular values sorted descending");
+        }
+        AssertTrue(sigma.back() >= 0.0, "singular values nonnegative");
+    }
+}
+
+void TestSVDModes() {
+    Matrix<double> a = RandomMatrix(24, 14);
+
+    SVDDecomposition<double> full;
+    full.Compute(a);
+
+    SVDDecomposition<double> values_only;
+    values_only.Compute(a, SVDMode::kValuesOnly);
+    AssertTrue(values_only.U().Rows() == 0 && values_only.V().Rows() == 0,
+               "values-only mode skips U and V");
+    for (std::size_t i = 0; i < 14; ++i) {
+        AssertNear(values_only.SingularValues()[i],
+                   full.SingularValues()[i], 1e-10,
+                   "values-only spectrum matches the full driver");
+    }
+
+    SVDDecomposition<double> thin;
+    thin.Compute(a, SVDMode::kThin);
+    AssertTrue(thin.U().Cols() == 14 && thin.V().Cols() == 14,
+               "thin factors have min(m, n) columns");
+    AssertMatrixNear(thin.U() * thin.SigmaMatrix() * thin.V().Transpose(),
+                     a, 1e-9, "thin factorization reconstructs A");
+
+    SVDDecomposition<double> top_k;
+    top_k.Compute(a, SVDMode::kTopK, 5);
+    AssertTrue(top_k.SingularValues().size() == 5 &&
+                   top_k.U().Cols() == 5 && top_k.V().Cols() == 5,
+               "top-k mode truncates to k triplets");
+    for (std::size_t i = 0; i < 5; ++i) {
+        AssertNear(top_k.SingularValues()[i], full.SingularValues()[i],
+                   1e-10, "top-k values are the leading ones");
+    }
+}
+
+void TestRandomizedSVD() {
+    // Exactly rank-6 input: the sketch captures the whole range, so the
+    // randomized driver should agree with the dense SVD to working accuracy.
+    Matrix<double> left = RandomMatrix(60, 6);
+    Matrix<double> right = RandomMatrix(40, 6);
+    Matrix<double> a = left * right.Transpose();
+
+    SVDResult<double> approx = RandomizedSVD(a, 6);
+    SVDDecomposition<double> dense;
+    dense.Compute(a);
+
+    for (std::size_t i = 0; i < 6; ++i) {
+        AssertNear(approx.singular_values[i], dense.SingularValues()[i],
+                   1e-8, "randomized values match the dense spectrum");
+    }
+
+    Matrix<double> sigma(6, 6);
+    for (std::size_t i = 0; i < 6; ++i) {
+        sigma(i, i) = approx.singular_values[i];
+    }
+    AssertMatrixNear(approx.u * sigma * approx.v.Transpose(), a, 1e-8,
+                     "randomized factors reconstruct the low-rank input");
+    AssertOrthogonal(approx.u.Transpose() * approx.u,
+                     "randomized U has orthonormal columns");
+}
+
+void TestThinQ() {
+    Matrix<double> a = RandomMatrix(50, 12);
+    QRDecomposition<double> qr;
+    qr.ComputeCompact(a);
+
+    Matrix<double> q = qr.MaterializeThinQ();
+    AssertTrue(q.Rows() == 50 && q.Cols() == 12,
+               "thin Q has min(m, n) columns");
+    AssertMatrixNear(q.Transpose() * q, Matrix<double>::Identity(12), 1e-10,
+                     "thin Q columns are orthonormal");
+
+    Matrix<double> r = qr.ExtractR();
+    Matrix<double> r_thin(12, 12);
+    for (std::size_t i = 0; i < 12; ++i) {
+        for (std::size_t j = i; j < 12; ++j) {
+            r_thin(i, j) = r(i, j);
+        }
+    }
+    AssertMatrixNear(q * r_thin, a, 1e-10, "thin Q * R reconstructs A");
+}
+
+void TestSVDKnownValues() {
+    // diag(3, 2, 1) has exactly those singular values.
+    Matrix<double> a = {{3.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 2.0}};
+    SVDDecomposition<double> svd;
+    svd.Compute(a);
+    const auto& sigma = svd.SingularValues();
+    AssertNear(sigma[0], 3.0, 1e-12, "largest singular value");
+    AssertNear(sigma[1], 2.0, 1e-12, "middle singular value");
+    AssertNear(sigma[2], 1.0, 1e-12, "smallest singular value");
+}
+
+}  // namespace
+
+int main() {
+    ThreadPool::SetGlobalThreadCount(4);
+    TestParallelFor();
+    TestQR();
+    TestBidiagonalization();
+    TestGivensWaveMatchesSequential();
+    TestSVD();
+    TestSVDModes();
+    TestRandomizedSVD();
+    TestThinQ();
+    TestSVDKnownValues();
+    std::cout << "test_decompositions: OK\n";
+    return 0;
+}
@@ -0,0 +1,96 @@
+#include <cstddef>
+#include <iostream>
+
+#include "../algorithms/factorization.h"
+#include "../types/matrix.h"
+#include "test_helpers.h"
+
+using namespace linalg;
+using namespace linalg::tests;
+
+namespace {
+
+// Diagonally dominated random matrix: comfortably invertible.
+Matrix<double> WellConditioned(std::size_t n) {
+    Matrix<double> a = RandomMatrix(n, n);
+    for (std::size_t i = 0; i < n; ++i) {
+        a(i, i) += double(n);
+    }
+    return a;
+}
+
+void TestSolveAndReuse() {
+    Matrix<double> a = WellConditioned(50);
+    Factorization<double> lu;
+    lu.Compute(a);
+    AssertTrue(!lu.Singular(), "factorization succeeds");
+
+    // The same factors serve many independent solves.
+    for (int round = 0; round < 3; ++round) {
+        Matrix<double> x_true = RandomMatrix(50, 1);
+        Matrix<double> x = lu.Solve(a * x_true);
+        AssertMatrixNear(x, x_true, 1e-9, "solve against stored factors");
+    }
+}
+
+void TestSolveMany() {
+    Matrix<double> a = WellConditioned(60);
+    Factorization<double> lu;
+    lu.Compute(a);
+
+    // Wider than one column panel, so the blocked path is exercised.
+    Matrix<double> x_true = RandomMatrix(60, 75);
+    Matrix<double> x = lu.SolveMany(a * x_true);
+    AssertMatrixNear(x, x_true, 1e-9, "blocked multi-RHS solve");
+}
+
+void TestDet() {
+    // Triangular reference: determinant is the diagonal product.
+    Matrix<double> t = {{2.0, 1.0, 5.0},
+                        {0.0, -3.0, 1.0},
+                        {0.0, 0.0, 4.0}};
+    Factorization<double> lu;
+    lu.Compute(t);
+    AssertNear(lu.Det(), -24.0, 1e-12, "triangular determinant");
+
+    // det(A * B) = det(A) * det(B) on random inputs.
+    Matrix<double> a = WellConditioned(8);
+    Matrix<double> b = WellConditioned(8);
+    Factorization<double> lu_a;
+    Factorization<double> lu_b;
+    Factorization<double> lu_ab;
+    lu_a.Compute(a);
+    lu_b.Compute(b);
+    lu_ab.Compute(a * b);
+    AssertNear(lu_ab.Det(), lu_a.Det() * lu_b.Det(),
+               1e-8 * std::abs(lu_ab.Det()), "determinant is multiplicative");
+
+    Matrix<double> singular = {{1.0, 2.0}, {2.0, 4.0}};
+    Factorization<double> lu_s;
+    lu_s.Compute(singular);
+    AssertTrue(lu_s.Singular(), "singular input detected");
+    AssertNear(lu_s.Det(), 0.0, 0.0, "singular determinant is zero");
+}
+
+void TestInverse() {
+    Matrix<double> a = WellConditioned(40);
+    Factorization<double> lu;
+    lu.Compute(a);
+
+    Matrix<double> inverse = lu.Inverse();
+    AssertMatrixNear(a * inverse, Matrix<double>::Identity(40), 1e-9,
+                     "A * A^{-1} = I");
+    AssertMatrixNear(inverse * a, Matrix<double>::Identity(40), 1e-9,
+                     "A^{-1} * A = I");
+}
+
+}  // namespace
+
+int main() {
+    TestSolveAndReuse();
+    TestSolveMany();
+    TestDet();
+    TestInverse();
+    std::cout << "test_factorization: OK\n";
+    return 0;
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+
+#include "../types/matrix.h"
+
+namespace linalg::tests {
+
+inline std::mt19937& Rng() {
+    static std::mt19937 generator(20231107);
+    return generator;
+}
+
+template <typename T = double>
+Matrix<T> RandomMatrix(std::size_t rows, std::size_t cols) {
+    std::uniform_real_distribution<T> dist(-1.0, 1.0);
+    Matrix<T> result(rows, cols);
+    for (std::size_t i = 0; i < rows; ++i) {
+        for (std::size_t j = 0; j < cols; ++j) {
+            result(i, j) = dist(Rng());
+        }
+    }
+    return result;
+}
+
+template <typename T>
+void AssertNear(T actual, T expected, T tolerance, const char* what) {
+    if (std::abs(actual - expected) > tolerance) {
+        std::cerr << "FAILED: " << what << " — expected " << expected
+                  << ", got " << actual << " (tolerance " << tolerance
+                  << ")\n";
+        std::exit(1);
+    }
+}
+
+template <typename T>
+void AssertMatrixNear(const Matrix<T>& actual, const Matrix<T>& expected,
+                      T tolerance, const char* what) {
+    if (actual.Rows() != expected.Rows() || actual.Cols() != expected.Cols()) {
+        std::cerr << "FAILED: " << what << " — dimension mismatch\n";
+        std::exit(1);
+    }
+    for (std::size_t i = 0; i < actual.Rows(); ++i) {
+        for (std::size_t j = 0; j < actual.Cols(); ++j) {
+            if (std::abs(actual(i, j) - expected(i, j)) > tolerance) {
+                std::cerr << "FAILED: " << what << " — entry (" << i << ", "
+                          << j << ") expected " << expected(i, j) << ", got "
+                          << actual(i, j) << "\n";
+                std::exit(1);
+            }
+        }
+    }
+}
+
+inline void AssertTrue(bool condition, const char* what) {
+    if (!condition) {
+        std::cerr << "FAILED: " << what << '\n';
+        std::exit(1);
+    }
+}
+
+}  // namespace linalg::tests
@@ -0,0 +1,105 @@
+#include <cstddef>
+#include <iostream>
+#include <vector>
+
+#include "../core/kernel_registry.h"
+#include "../types/matrix.h"
+#include "test_helpers.h"
+
+using namespace linalg;
+using namespace linalg::tests;
+
+namespace {
+
+// Whatever variant the host resolved must agree with the scalar reference;
+// on an AVX machine this exercises the vector paths, elsewhere it is a
+// (trivially true) scalar-vs-scalar check.
+void TestRegistryMatchesScalar() {
+    const auto& table = simd::Kernels<double>();
+    AssertTrue(table.level == simd::DetectIsaLevel(),
+               "table bound to the detected ISA");
+
+    for (std::size_t n : {1, 7, 8, 64, 129}) {
+        Matrix<double> data = RandomMatrix(4, n);
+        std::vector<double> x(data.Data(), data.Data() + n);
+        std::vector<double> y(data.Data() + n, data.Data() + 2 * n);
+
+        std::vector<double> y_ref = y;
+        simd::detail::AxpyScalar(1.7, x.data(), y_ref.data(), n);
+        table.axpy(1.7, x.data(), y.data(), n);
+        for (std::size_t i = 0; i < n; ++i) {
+            AssertNear(y[i], y_ref[i], 1e-14, "axpy matches scalar");
+        }
+
+        AssertNear(table.dot(x.data(), y.data(), n),
+                   simd::detail::DotScalar(x.data(), y.data(), n), 1e-12,
+                   "dot matches scalar");
+
+        std::vector<double> gx = x;
+        std::vector<double> gy = y;
+        std::vector<double> gx_ref = x;
+        std::vector<double> gy_ref = y;
+        simd::detail::GivensScalar(0.6, 0.8, gx_ref.data(), gy_ref.data(),
+                                   n);
+        simd::GivensApply(0.6, 0.8, gx.data(), gy.data(), n);
+        for (std::size_t i = 0; i < n; ++i) {
+            AssertNear(gx[i], gx_ref[i], 1e-14, "givens x matches scalar");
+            AssertNear(gy[i], gy_ref[i], 1e-14, "givens y matches scalar");
+        }
+    }
+}
+
+void TestGivensRotates() {
+    // c = 1, s = 0 is the identity; a quarter turn swaps with a sign.
+    std::vector<double> x = {1.0, 2.0};
+    std::vector<double> y = {3.0, 4.0};
+    simd::GivensApply(0.0, 1.0, x.data(), y.data(), 2);
+    AssertNear(x[0], 3.0, 0.0, "quarter turn");
+    AssertNear(y[0], -1.0, 0.0, "quarter turn");
+    AssertNear(x[1], 4.0, 0.0, "quarter turn");
+    AssertNear(y[1], -2.0, 0.0, "quarter turn");
+}
+
+// Drives the dispatched microkernel over full and partial tiles and checks
+// against the scalar reference, including the packed-B layout.
+template <typename T>
+void TestMicroKernelTiles() {
+    const std::size_t kc = 37;
+    Matrix<T> a_src = RandomMatrix<T>(simd::kMicroM, kc);
+    Matrix<T> b_src = RandomMatrix<T>(kc, simd::kMicroN);
+
+    std::vector<T> a(a_src.Data(), a_src.Data() + simd::kMicroM * kc);
+    std::vector<T> packed(kc * simd::kMicroN);
+    for (std::size_t p = 0; p < kc; ++p) {
+        for (std::size_t j = 0; j < simd::kMicroN; ++j) {
+            packed[p * simd::kMicroN + j] = b_src(p, j);
+        }
+    }
+
+    for (std::size_t mr = 1; mr <= simd::kMicroM; ++mr) {
+        for (std::size_t nr = 1; nr <= simd::kMicroN; ++nr) {
+            std::vector<T> c(simd::kMicroM * simd::kMicroN, T{1});
+            std::vector<T> c_ref = c;
+            simd::MicroKernel(a.data(), kc, packed.data(), c.data(),
+                              simd::kMicroN, kc, mr, nr);
+            simd::detail::MicroKernelScalar(a.data(), kc, packed.data(),
+                                            c_ref.data(), simd::kMicroN,
+                                            kc, mr, nr);
+            for (std::size_t i = 0; i < c.size(); ++i) {
+                AssertNear(double(c[i]), double(c_ref[i]), 1e-4,
+                           "microkernel tile matches scalar");
+            }
+        }
+    }
+}
+
+}  // namespace
+
+int main() {
+    TestRegistryMatchesScalar();
+    TestGivensRotates();
+    TestMicroKernelTiles<double>();
+    TestMicroKernelTiles<float>();
+    std::cout << "test_kernel_registry: OK\n";
+    return 0;
+}
@@ -0,0 +1,127 @@
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+
+#include "../algorithms/qr_decomposition.h"
+#include "../types/matrix.h"
+#include "test_helpers.h"
+
+using namespace linalg;
+using namespace linalg::tests;
+
+namespace {
+
+using ColMatrix = Matrix<double, kDynamic, kDynamic, Layout::kColMajor>;
+
+ColMatrix ToColMajor(const Matrix<double>& source) {
+    ColMatrix result(source.Rows(), source.Cols());
+    for (std::size_t i = 0; i < source.Rows(); ++i) {
+        for (std::size_t j = 0; j < source.Cols(); ++j) {
+            result(i, j) = source(i, j);
+        }
+    }
+    return result;
+}
+
+void TestColMajorStorageOrder() {
+    ColMatrix a = {{1.0, 2.0}, {3.0, 4.0}};
+    // Columns are contiguous: the buffer holds (1, 3, 2, 4).
+    AssertNear(a.Data()[0], 1.0, 0.0, "buffer order");
+    AssertNear(a.Data()[1], 3.0, 0.0, "buffer order");
+    AssertNear(a.Data()[2], 2.0, 0.0, "buffer order");
+    AssertNear(a.Data()[3], 4.0, 0.0, "buffer order");
+}
+
+void TestColMajorArithmetic() {
+    for (auto [m, n, k] : {std::tuple<std::size_t, std::size_t, std::size_t>{
+                               20, 30, 25},
+                           {100, 80, 90}}) {
+        Matrix<double> a_row = RandomMatrix(m, k);
+        Matrix<double> b_row = RandomMatrix(k, n);
+        Matrix<double> c_row = a_row * b_row;
+
+        ColMatrix c_col = ToColMajor(a_row) * ToColMajor(b_row);
+        for (std::size_t i = 0; i < m; ++i) {
+            for (std::size_t j = 0; j < n; ++j) {
+                AssertNear(c_col(i, j), c_row(i, j), 1e-12,
+                           "column-major product matches row-major");
+            }
+        }
+    }
+
+    Matrix<double> a_row = RandomMatrix(45, 33);
+    ColMatrix at = ToColMajor(a_row).Transpose();
+    for (std::size_t i = 0; i < 45; ++i) {
+        for (std::size_t j = 0; j < 33; ++j) {
+            AssertNear(at(j, i), a_row(i, j), 0.0,
+                       "column-major transpose entry");
+        }
+    }
+}
+
+// The reflector kernels take the unit-stride branch for column-major
+// operands; both layouts must produce the same factorization.
+void TestColMajorQR() {
+    for (auto [m, n] : {std::pair<std::size_t, std::size_t>{40, 40},
+                        {60, 25}}) {
+        Matrix<double> a_row = RandomMatrix(m, n);
+        ColMatrix a_col = ToColMajor(a_row);
+
+        QRDecomposition<double> qr_row;
+        qr_row.Compute(a_row);
+        QRDecomposition<double, Layout::kColMajor> qr_col;
+        qr_col.Compute(a_col);
+
+        for (std::size_t i = 0; i < m; ++i) {
+            for (std::size_t j = 0; j < n; ++j) {
+                AssertNear(qr_col.R()(i, j), qr_row.R()(i, j), 1e-10,
+                           "layouts produce the same R");
+            }
+        }
+
+        // Q * R must reconstruct A in the column-major world too.
+        ColMatrix reconstructed = qr_col.Q() * qr_col.R();
+        for (std::size_t i = 0; i < m; ++i) {
+            for (std::size_t j = 0; j < n; ++j) {
+                AssertNear(reconstructed(i, j), a_row(i, j), 1e-10,
+                           "column-major Q * R reconstructs A");
+            }
+        }
+    }
+}
+
+void TestColMajorCompactQR() {
+    Matrix<double> a_row = RandomMatrix(50, 18);
+    QRDecomposition<double, Layout::kColMajor> qr;
+    qr.ComputeCompact(ToColMajor(a_row));
+
+    ColMatrix q = qr.MaterializeThinQ();
+    ColMatrix r = qr.ExtractR();
+    ColMatrix product(50, 18);
+    for (std::size_t i = 0; i < 50; ++i) {
+        for (std::size_t j = 0; j < 18; ++j) {
+            double sum = 0.0;
+            for (std::size_t p = 0; p < 18; ++p) {
+                sum += q(i, p) * r(p, j);
+            }
+            product(i, j) = sum;
+        }
+    }
+    for (std::size_t i = 0; i < 50; ++i) {
+        for (std::size_t j = 0; j < 18; ++j) {
+            AssertNear(product(i, j), a_row(i, j), 1e-10,
+                       "column-major compact QR reconstructs A");
+        }
+    }
+}
+
+}  // namespace
+
+int main() {
+    TestColMajorStorageOrder();
+    TestColMajorArithmetic();
+    TestColMajorQR();
+    TestColMajorCompactQR();
+    std::cout << "test_layout: OK\n";
+    return 0;
+}
@@ -0,0 +1,59 @@
+#include <cstddef>
+#include <iostream>
+
+#include "../algorithms/least_squares.h"
+#include "../types/matrix.h"
+#include "test_helpers.h"
+
+using namespace linalg;
+using namespace linalg::tests;
+
+namespace {
+
+void TestThinQR() {
+    Matrix<double> a = RandomMatrix(120, 30);
+    auto [q, r] = ThinQR(a);
+    AssertTrue(q.Rows() == 120 && q.Cols() == 30, "thin Q shape");
+    AssertTrue(r.Rows() == 30 && r.Cols() == 30, "thin R shape");
+
+    AssertMatrixNear(q * r, a, 1e-10, "thin Q * R reconstructs A");
+    Matrix<double> gram = MultiplyAtB(q, q);
+    AssertMatrixNear(gram, Matrix<double>::Identity(30), 1e-12,
+                     "thin Q has orthonormal columns");
+}
+
+void TestLeastSquaresConsistent() {
+    // Tall enough to stream several panels, with an exact solution.
+    Matrix<double> a = RandomMatrix(700, 12);
+    Matrix<double> x_true = RandomMatrix(12, 3);
+    Matrix<double> b = a * x_true;
+
+    Matrix<double> x = LeastSquaresSolve(a, b);
+    AssertMatrixNear(x, x_true, 1e-9, "consistent system solved exactly");
+}
+
+void TestLeastSquaresResidual() {
+    // Inconsistent system: the minimizer satisfies A^T (A x - b) = 0.
+    Matrix<double> a = RandomMatrix(500, 20);
+    Matrix<double> b = RandomMatrix(500, 2);
+
+    Matrix<double> x = LeastSquaresSolve(a, b);
+    Matrix<double> residual = b - a * x;
+    Matrix<double> normal = MultiplyAtB(a, residual);
+    for (std::size_t i = 0; i < 20; ++i) {
+        for (std::size_t j = 0; j < 2; ++j) {
+            AssertNear(normal(i, j), 0.0, 1e-8,
+                       "solution satisfies the normal equations");
+        }
+    }
+}
+
+}  // namespace
+
+int main() {
+    TestThinQR();
+    TestLeastSquaresConsistent();
+    TestLeastSquaresResidual();
+    std::cout << "test_least_squares: OK\n";
+    return 0;
+}
@@ -0,0 +1,142 @@
+#include <iostream>
+
+#include "../types/matrix.h"
+#include "test_helpers.h"
+
+using namespace linalg;
+using namespace linalg::tests;
+
+namespace {
+
+void TestBasicArithmetic() {
+    Matrix<double> a = {{1.0, 2.0}, {3.0, 4.0}};
+    Matrix<double> b = {{5.0, 6.0}, {7.0, 8.0}};
+
+    Matrix<double> sum = a + b;
+    AssertMatrixNear(sum, Matrix<double>{{6.0, 8.0}, {10.0, 12.0}}, 1e-15,
+                     "matrix addition");
+
+    Matrix<double> diff = b - a;
+    AssertMatrixNear(diff, Matrix<double>{{4.0, 4.0}, {4.0, 4.0}}, 1e-15,
+                     "matrix subtraction");
+
+    Matrix<double> scaled = 2.0 * a;
+    AssertMatrixNear(scaled, Matrix<double>{{2.0, 4.0}, {6.0, 8.0}}, 1e-15,
+                     "scalar multiplication");
+}
+
+void TestSmallMultiply() {
+    Matrix<double> a = {{1.0, 2.0}, {3.0, 4.0}};
+    Matrix<double> b = {{5.0, 6.0}, {7.0, 8.0}};
+    Matrix<double> product = a * b;
+    AssertMatrixNear(product, Matrix<double>{{19.0, 22.0}, {43.0, 50.0}},
+                     1e-15, "2x2 multiplication");
+
+    Matrix<double> identity = Matrix<double>::Identity(7);
+    Matrix<double> c = RandomMatrix(7, 7);
+    AssertMatrixNear(identity * c, c, 1e-15, "identity multiplication");
+}
+
+// The blocked path must agree with the reference loop for shapes that
+// exercise full tiles, partial tiles, and every microkernel edge case.
+void TestBlockedMultiplyMatchesNaive() {
+    const std::size_t shapes[][3] = {
+        {48, 48, 48},  {64, 64, 64},   {100, 100, 100}, {129, 67, 211},
+        {70, 300, 50}, {257, 31, 130}, {300, 300, 300},
+    };
+    for (const auto& shape : shapes) {
+        std::size_t m = shape[0];
+        std::size_t n = shape[1];
+        std::size_t k = shape[2];
+        Matrix<double> a = RandomMatrix(m, k);
+        Matrix<double> b = RandomMatrix(k, n);
+
+        Matrix<double> expected(m, n);
+        detail::NaiveMultiply(a.Data(), b.Data(), expected.Data(), m, n, k);
+
+        Matrix<double> actual = a * b;
+        AssertMatrixNear(actual, expected, 1e-12,
+                         "blocked multiplication vs reference");
+    }
+}
+
+// Compound expressions must fuse into a single evaluation pass and reuse the
+// destination's storage when the shape is unchanged.
+void TestExpressionTemplates() {
+    Matrix<double> a = RandomMatrix(31, 17);
+    Matrix<double> b = RandomMatrix(31, 17);
+    Matrix<double> d = RandomMatrix(31, 17);
+
+    Matrix<double> expected(31, 17);
+    for (std::size_t i = 0; i < 31; ++i) {
+        for (std::size_t j = 0; j < 17; ++j) {
+            expected(i, j) = a(i, j) + b(i, j) - 2.0 * d(i, j);
+        }
+    }
+    Matrix<double> c = a + b - 2.0 * d;
+    AssertMatrixNear(c, expected, 1e-15, "fused compound expression");
+
+    const double* storage = c.Data();
+    c = b - a + d * 3.0;
+    AssertTrue(c.Data() == storage,
+               "same-shape assignment reuses storage");
+
+    Matrix<double> sum = a + b;
+    Matrix<double> aliased = a;
+    aliased = aliased + b;
+    AssertMatrixNear(aliased, sum, 1e-15, "aliased elementwise assignment");
+}
+
+void TestTranspose() {
+    // Shapes straddling the transpose tile edge, so full tiles, ragged edge
+    // tiles, and the sub-tile case are all exercised.
+    for (auto [m, n] : {std::pair<std::size_t, std::size_t>{13, 29},
+                        {32, 32},
+                        {100, 45},
+                        {33, 97}}) {
+        Matrix<double> a = RandomMatrix(m, n);
+        Matrix<double> at = a.Transpose();
+        AssertTrue(at.Rows() == n && at.Cols() == m, "transpose dimensions");
+        for (std::size_t i = 0; i < a.Rows(); ++i) {
+            for (std::size_t j = 0; j < a.Cols(); ++j) {
+                AssertNear(at(j, i), a(i, j), 0.0, "transpose entry");
+            }
+        }
+    }
+}
+
+// The transposed-multiply entry points must match multiplying by a
+// materialized transpose, across both dispatch paths.
+void TestMultiplyTransposed() {
+    const std::size_t shapes[][3] = {
+        {10, 12, 14}, {48, 70, 64}, {129, 67, 100}, {31, 200, 77},
+    };
+    for (const auto& shape : shapes) {
+        std::size_t m = shape[0];
+        std::size_t n = shape[1];
+        std::size_t k = shape[2];
+
+        Matrix<double> a = RandomMatrix(k, m);
+        Matrix<double> b = RandomMatrix(k, n);
+        AssertMatrixNear(MultiplyAtB(a, b), a.Transpose() * b, 1e-12,
+                         "A^T * B matches materialized transpose");
+
+        Matrix<double> c = RandomMatrix(m, k);
+        Matrix<double> d = RandomMatrix(n, k);
+        AssertMatrixNear(MultiplyABt(c, d), c * d.Transpose(), 1e-12,
+                         "A * B^T matches materialized transpose");
+    }
+}
+
+}  // namespace
+
+int main() {
+    TestBasicArithmetic();
+    TestSmallMultiply();
+    TestBlockedMultiplyMatchesNaive();
+    TestExpressionTemplates();
+    TestTranspose();
+    TestMultiplyTransposed();
+    std::cout << "test_matrix: OK\n";
+    return 0;
+}
@@ -0,0 +1,72 @@
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+
+#include "../core/numa.h"
+#include "../core/task_scheduler.h"
+#include "../types/matrix.h"
+#include "test_helpers.h"
+
+using namespace linalg;
+using namespace linalg::tests;
+
+namespace {
+
+void TestPageAlignedBacking() {
+    Matrix<double> a(100, 100);
+    auto address = reinterpret_cast<std::uintptr_t>(a.Data());
+    AssertTrue(address % numa::kPageSize == 0,
+               "matrix backing is page aligned");
+}
+
+// Pre-touched storage must still come back zeroed and behave like any
+// other matrix; this drives both placement policies over an allocation
+// large enough to cross the pre-touch threshold.
+void TestPreTouchedAllocation() {
+    const std::size_t n = 900;  // 900 x 900 doubles = 6.2 MB, above threshold
+    for (NumaPolicy policy :
+         {NumaPolicy::kInterleaved, NumaPolicy::kPartitioned}) {
+        numa::SetPolicy(policy);
+        Matrix<double> a(n, n);
+        for (std::size_t i = 0; i < n; i += 97) {
+            for (std::size_t j = 0; j < n; j += 89) {
+                AssertNear(a(i, j), 0.0, 0.0, "pre-touched store is zeroed");
+            }
+        }
+        a(0, 0) = 1.0;
+        a(n - 1, n - 1) = 2.0;
+        AssertNear(a(0, 0) + a(n - 1, n - 1), 3.0, 0.0,
+                   "pre-touched store is writable");
+    }
+    numa::SetPolicy(NumaPolicy::kFirstTouch);
+}
+
+void TestThreadPinning() {
+    ThreadPool& pool = ThreadPool::Global();
+    std::size_t pinned = pool.PinThreads();
+    AssertTrue(pinned == pool.ThreadCount(), "every pool thread pinned");
+
+    // Pinned workers must still execute work.
+    Matrix<double> a = RandomMatrix(64, 64);
+    Matrix<double> b = RandomMatrix(64, 64);
+    Matrix<double> product = a * b;
+    double checksum = 0.0;
+    for (std::size_t i = 0; i < 64; ++i) {
+        checksum += product(i, i);
+    }
+    AssertTrue(checksum != 0.0, "pool still computes after pinning");
+
+    TaskScheduler& scheduler = TaskScheduler::Global();
+    AssertTrue(scheduler.PinThreads() == scheduler.ThreadCount(),
+               "every scheduler thread pinned");
+}
+
+}  // namespace
+
+int main() {
+    TestPageAlignedBacking();
+    TestPreTouchedAllocation();
+    TestThreadPinning();
+    std::cout << "test_numa: OK\n";
+    return 0;
+}
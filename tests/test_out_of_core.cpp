@@ -0,0 +1,95 @@
+#include <cstddef>
+#include <cstdio>
+#include <iostream>
+#include <string>
+
+#include "../algorithms/out_of_core.h"
+#include "../types/streaming.h"
+#include "test_helpers.h"
+
+using namespace linalg;
+using namespace linalg::tests;
+
+namespace {
+
+const std::string kPath = "out_of_core_test.bin";
+
+// Writes the matrix through the streaming writer in uneven panels, so the
+// file is produced the same way a real pipeline stage would produce it.
+void WritePanelwise(const Matrix<double>& a, std::size_t panel_rows) {
+    RowPanelWriter<double> writer(kPath, a.Cols());
+    ConstMatrixView<double> view(a);
+    for (std::size_t begin = 0; begin < a.Rows(); begin += panel_rows) {
+        std::size_t rows = std::min(panel_rows, a.Rows() - begin);
+        AssertTrue(writer.AppendPanel(
+                       view.Submatrix(begin, 0, rows, a.Cols())),
+                   "panel append succeeds");
+    }
+    AssertTrue(writer.Close(), "writer finalizes the header");
+}
+
+void TestPanelRoundTrip() {
+    Matrix<double> a = RandomMatrix(130, 11);
+    WritePanelwise(a, 32);
+
+    // Read back with a panel size that does not divide the row count.
+    auto reader = RowPanelReader<double>::Open(kPath, 37);
+    AssertTrue(reader.has_value(), "reader opens the streamed file");
+    AssertTrue(reader->Rows() == 130 && reader->Cols() == 11,
+               "streamed dimensions match");
+
+    std::size_t row = 0;
+    for (std::size_t p = 0; p < reader->PanelCount(); ++p) {
+        ConstMatrixView<double> panel = reader->Panel(p);
+        for (std::size_t i = 0; i < panel.Rows(); ++i, ++row) {
+            for (std::size_t j = 0; j < 11; ++j) {
+                AssertNear(panel(i, j), a(row, j), 0.0,
+                           "panel entry matches the source row");
+            }
+        }
+    }
+    AssertTrue(row == 130, "panels cover every row exactly once");
+}
+
+void TestStreamedGram() {
+    Matrix<double> a = RandomMatrix(300, 14);
+    WritePanelwise(a, 64);
+
+    auto reader = RowPanelReader<double>::Open(kPath, 48);
+    AssertTrue(reader.has_value(), "reader opens the streamed file");
+
+    AssertMatrixNear(StreamedGram(*reader), MultiplyAtB(a, a), 1e-10,
+                     "streamed Gram matches the in-memory product");
+}
+
+void TestStreamedTallSkinnyQR() {
+    Matrix<double> a = RandomMatrix(500, 12);
+    WritePanelwise(a, 100);
+
+    auto reader = RowPanelReader<double>::Open(kPath, 73);
+    AssertTrue(reader.has_value(), "reader opens the streamed file");
+
+    Matrix<double> r = StreamedTallSkinnyQR(*reader);
+    AssertTrue(r.Rows() == 12 && r.Cols() == 12,
+               "streamed R is the square triangle");
+    for (std::size_t i = 0; i < 12; ++i) {
+        for (std::size_t j = 0; j < i; ++j) {
+            AssertNear(r(i, j), 0.0, 1e-12, "streamed R upper triangular");
+        }
+    }
+
+    // R is unique up to row signs, so compare through R^T R = A^T A.
+    AssertMatrixNear(MultiplyAtB(r, r), MultiplyAtB(a, a), 1e-9,
+                     "streamed R reproduces the Gram matrix");
+}
+
+}  // namespace
+
+int main() {
+    TestPanelRoundTrip();
+    TestStreamedGram();
+    TestStreamedTallSkinnyQR();
+    std::remove(kPath.c_str());
+    std::cout << "test_out_of_core: OK\n";
+    return 0;
+}
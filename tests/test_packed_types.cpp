@@ -0,0 +1,113 @@
+#include <cstddef>
+#include <iostream>
+
+#include "../algorithms/qr_decomposition.h"
+#include "../types/banded_matrix.h"
+#include "../types/matrix.h"
+#include "../types/triangular_matrix.h"
+#include "test_helpers.h"
+
+using namespace linalg;
+using namespace linalg::tests;
+
+namespace {
+
+// A well-conditioned triangular test matrix: random entries with the
+// diagonal pushed away from zero.
+Matrix<double> RandomTriangularDense(std::size_t n, TriangularKind kind) {
+    Matrix<double> dense(n, n);
+    for (std::size_t i = 0; i < n; ++i) {
+        std::size_t j_begin = kind == TriangularKind::kUpper ? i : 0;
+        std::size_t j_end = kind == TriangularKind::kUpper ? n : i + 1;
+        for (std::size_t j = j_begin; j < j_end; ++j) {
+            dense(i, j) = RandomMatrix(1, 1)(0, 0);
+        }
+        dense(i, i) += (dense(i, i) >= 0.0 ? 2.0 : -2.0);
+    }
+    return dense;
+}
+
+void TestTriangularRoundTrip() {
+    for (TriangularKind kind :
+         {TriangularKind::kUpper, TriangularKind::kLower}) {
+        Matrix<double> dense = RandomTriangularDense(17, kind);
+        TriangularMatrix<double> packed =
+            TriangularMatrix<double>::FromDense(dense, kind);
+        AssertMatrixNear(packed.ToDense(), dense, 0.0,
+                         "packed triangle round-trips through dense");
+    }
+}
+
+void TestTriangularSolveAndMultiply() {
+    for (TriangularKind kind :
+         {TriangularKind::kUpper, TriangularKind::kLower}) {
+        Matrix<double> dense = RandomTriangularDense(23, kind);
+        TriangularMatrix<double> packed =
+            TriangularMatrix<double>::FromDense(dense, kind);
+        Matrix<double> b = RandomMatrix(23, 4);
+
+        AssertMatrixNear(packed * b, dense * b, 1e-12,
+                         "packed multiply matches dense");
+
+        Matrix<double> x = packed.Solve(b);
+        AssertMatrixNear(dense * x, b, 1e-10,
+                         "substitution solve satisfies T * X = B");
+    }
+}
+
+void TestBandedKernels() {
+    // Tridiagonal band packed from a dense source.
+    Matrix<double> dense(20, 20);
+    for (std::size_t i = 0; i < 20; ++i) {
+        dense(i, i) = 4.0 + 0.1 * i;
+        if (i + 1 < 20) {
+            dense(i, i + 1) = -1.0 + 0.05 * i;
+            dense(i + 1, i) = -1.3 + 0.02 * i;
+        }
+    }
+    BandedMatrix<double> band = BandedMatrix<double>::FromDense(dense, 1, 1);
+    AssertMatrixNear(band.ToDense(), dense, 0.0,
+                     "band round-trips through dense");
+
+    Matrix<double> b = RandomMatrix(20, 3);
+    AssertMatrixNear(band * b, dense * b, 1e-12,
+                     "band multiply matches dense");
+
+    // Upper bidiagonal band: the triangular-band substitution solve.
+    Matrix<double> bidiagonal(20, 20);
+    for (std::size_t i = 0; i < 20; ++i) {
+        bidiagonal(i, i) = 3.0 + 0.2 * i;
+        if (i + 1 < 20) {
+            bidiagonal(i, i + 1) = 0.7 - 0.03 * i;
+        }
+    }
+    BandedMatrix<double> upper =
+        BandedMatrix<double>::FromDense(bidiagonal, 0, 1);
+    Matrix<double> x = upper.Solve(b);
+    AssertMatrixNear(bidiagonal * x, b, 1e-10,
+                     "band substitution solve satisfies B * X = R");
+}
+
+// The intended consumer: solve A x = b through compact QR with the packed
+// triangular factor, never touching R's zero half.
+void TestQRTriangularSolve() {
+    Matrix<double> a = RandomMatrix(30, 30);
+    Matrix<double> b = RandomMatrix(30, 2);
+
+    QRDecomposition<double> qr;
+    qr.ComputeCompact(a);
+    Matrix<double> q = qr.MaterializeThinQ();
+    Matrix<double> x = qr.TriangularR().Solve(MultiplyAtB(q, b));
+    AssertMatrixNear(a * x, b, 1e-9, "QR solve via packed R");
+}
+
+}  // namespace
+
+int main() {
+    TestTriangularRoundTrip();
+    TestTriangularSolveAndMultiply();
+    TestBandedKernels();
+    TestQRTriangularSolve();
+    std::cout << "test_packed_types: OK\n";
+    return 0;
+}
@@ -0,0 +1,79 @@
+// Opts this translation unit into the instrumentation; the rest of the
+// suite builds without it and exercises the compiled-out path.
+#define LINALG_ENABLE_PERF
+
+#include <cstddef>
+#include <iostream>
+
+#include "../algorithms/qr_algorithm.h"
+#include "../algorithms/qr_decomposition.h"
+#include "../algorithms/svd.h"
+#include "test_helpers.h"
+
+using namespace linalg;
+using namespace linalg::tests;
+
+namespace {
+
+void TestQRCounters() {
+    Matrix<double> a = RandomMatrix(80, 50);
+    QRDecomposition<double> qr;
+    qr.ComputeCompact(a);
+
+    const PerfReport& report = qr.Perf();
+    AssertTrue(report.reflectors == 50, "one reflector per column");
+    AssertTrue(report.flops > 0, "flop estimate recorded");
+    AssertTrue(report.factor_seconds > 0.0, "factor phase timed");
+    AssertTrue(report.scratch_bytes > 0, "cold call grows the arena");
+
+    // Same shape again: the arena is warm, so no growth is recorded.
+    qr.ComputeCompact(a);
+    AssertTrue(qr.Perf().scratch_bytes == 0,
+               "warm call allocates no scratch");
+
+    qr.MaterializeThinQ();
+    AssertTrue(qr.Perf().materialize_seconds > 0.0,
+               "materialization timed");
+}
+
+void TestEigenCounters() {
+    Matrix<double> base = RandomMatrix(40, 40);
+    Matrix<double> a = base + base.Transpose();
+
+    QRAlgorithm<double> eigen;
+    eigen.Compute(a);
+    const PerfReport& report = eigen.Perf();
+    AssertTrue(report.sweeps > 0, "shifted steps counted");
+    AssertTrue(report.deflations > 0, "deflations counted");
+    AssertTrue(report.reduce_seconds > 0.0, "reduction phase timed");
+    AssertTrue(report.iterate_seconds > 0.0, "iteration phase timed");
+
+    // A second Compute resets the report rather than accumulating forever.
+    std::uint64_t first_sweeps = report.sweeps;
+    eigen.Compute(a);
+    AssertTrue(eigen.Perf().sweeps <= 2 * first_sweeps,
+               "report resets per call");
+}
+
+void TestSVDCounters() {
+    Matrix<double> a = RandomMatrix(60, 35);
+    SVDDecomposition<double> svd;
+    svd.Compute(a);
+
+    const PerfReport& report = svd.Perf();
+    AssertTrue(report.reflectors == 70, "bidiagonalization reflectors");
+    AssertTrue(report.sweeps > 0, "Golub-Kahan sweeps counted");
+    AssertTrue(report.deflations > 0, "converged superdiagonals counted");
+    AssertTrue(report.reduce_seconds > 0.0, "bidiagonalization timed");
+    AssertTrue(report.iterate_seconds > 0.0, "bidiagonal iteration timed");
+}
+
+}  // namespace
+
+int main() {
+    TestQRCounters();
+    TestEigenCounters();
+    TestSVDCounters();
+    std::cout << "test_perf: OK\n";
+    return 0;
+}
@@ -0,0 +1,99 @@
+#include <cstddef>
+#include <iostream>
+
+#include "../algorithms/pivoted_qr.h"
+#include "../types/matrix.h"
+#include "test_helpers.h"
+
+using namespace linalg;
+using namespace linalg::tests;
+
+namespace {
+
+void TestFullRankFactorization() {
+    Matrix<double> a = RandomMatrix(60, 40);
+    PivotedQRDecomposition<double> qr;
+    qr.Compute(a);
+
+    AssertTrue(qr.Rank() == 40, "random matrix is full rank");
+
+    Matrix<double> q = qr.MaterializeThinQ();
+    Matrix<double> r = qr.ExtractR();
+    Matrix<double> product = q * r;
+    const auto& perm = qr.Permutation();
+    for (std::size_t i = 0; i < a.Rows(); ++i) {
+        for (std::size_t j = 0; j < a.Cols(); ++j) {
+            AssertNear(product(i, j), a(i, perm[j]), 1e-10,
+                       "Q * R reconstructs the permuted columns");
+        }
+    }
+}
+
+// The point of the pivoted factorization: a 200 x 120 matrix of exact rank
+// 12 must terminate after 12 steps, not 120.
+void TestEarlyTermination() {
+    const std::size_t rank = 12;
+    Matrix<double> left = RandomMatrix(200, rank);
+    Matrix<double> right = RandomMatrix(rank, 120);
+    Matrix<double> a = left * right;
+
+    PivotedQRDecomposition<double> qr;
+    qr.Compute(a);
+    AssertTrue(qr.Rank() == rank, "detected numerical rank");
+
+    // The rank x n trapezoid still reconstructs the whole matrix.
+    Matrix<double> product = qr.MaterializeThinQ() * qr.ExtractR();
+    const auto& perm = qr.Permutation();
+    for (std::size_t i = 0; i < a.Rows(); ++i) {
+        for (std::size_t j = 0; j < a.Cols(); ++j) {
+            AssertNear(product(i, j), a(i, perm[j]), 1e-9,
+                       "truncated Q * R reconstructs a low-rank matrix");
+        }
+    }
+}
+
+void TestExplicitTolerance() {
+    // Two dominant columns plus noise at 1e-8: a loose tolerance stops at
+    // rank 2, the default keeps going.
+    Matrix<double> base = RandomMatrix(50, 2) * RandomMatrix(2, 30);
+    Matrix<double> a(50, 30);
+    for (std::size_t i = 0; i < 50; ++i) {
+        for (std::size_t j = 0; j < 30; ++j) {
+            a(i, j) = base(i, j) + 1e-8 * std::sin(double(i * 31 + j));
+        }
+    }
+
+    PivotedQRDecomposition<double> loose;
+    loose.Compute(a, 1e-6);
+    AssertTrue(loose.Rank() == 2, "tolerance truncates below the noise");
+
+    PivotedQRDecomposition<double> tight;
+    tight.Compute(a);
+    AssertTrue(tight.Rank() > 2, "default tolerance keeps the noise");
+}
+
+void TestOrthonormalBasis() {
+    Matrix<double> a = RandomMatrix(80, 10) * RandomMatrix(10, 50);
+    PivotedQRDecomposition<double> qr;
+    qr.Compute(a);
+
+    Matrix<double> q = qr.MaterializeThinQ();
+    Matrix<double> gram = MultiplyAtB(q, q);
+    for (std::size_t i = 0; i < qr.Rank(); ++i) {
+        for (std::size_t j = 0; j < qr.Rank(); ++j) {
+            AssertNear(gram(i, j), i == j ? 1.0 : 0.0, 1e-12,
+                       "thin Q has orthonormal columns");
+        }
+    }
+}
+
+}  // namespace
+
+int main() {
+    TestFullRankFactorization();
+    TestEarlyTermination();
+    TestExplicitTolerance();
+    TestOrthonormalBasis();
+    std::cout << "test_pivoted_qr: OK\n";
+    return 0;
+}
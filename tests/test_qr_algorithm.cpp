@@ -0,0 +1,117 @@
+#include <cmath>
+#include <iostream>
+
+#include "../algorithms/hessenberg.h"
+#include "../algorithms/qr_algorithm.h"
+#include "../algorithms/qr_decomposition.h"
+#include "test_helpers.h"
+
+using namespace linalg;
+using namespace linalg::tests;
+
+namespace {
+
+Matrix<double> RandomSymmetric(std::size_t n) {
+    Matrix<double> m = RandomMatrix(n, n);
+    return m + m.Transpose();
+}
+
+void CheckEigenDecomposition(const Matrix<double>& a, double tolerance) {
+    QRAlgorithm<double> eig;
+    eig.Compute(a);
+
+    const Matrix<double>& q = eig.Eigenvectors();
+    AssertMatrixNear(q * q.Transpose(), Matrix<double>::Identity(a.Rows()),
+                     1e-9, "eigenvector matrix is orthogonal");
+
+    Matrix<double> lambda(a.Rows(), a.Rows());
+    for (std::size_t i = 0; i < a.Rows(); ++i) {
+        lambda(i, i) = eig.Eigenvalues()[i];
+    }
+    AssertMatrixNear(q * lambda * q.Transpose(), a, tolerance,
+                     "Q * diag(lambda) * Q^T reconstructs A");
+
+    for (std::size_t i = 0; i + 1 < a.Rows(); ++i) {
+        AssertTrue(eig.Eigenvalues()[i] >= eig.Eigenvalues()[i + 1],
+                   "eigenvalues sorted descending");
+    }
+}
+
+void TestHessenbergReduce() {
+    Matrix<double> a = RandomMatrix(18, 18);
+    Matrix<double> q, h;
+    HessenbergReduce(a, q, h);
+
+    AssertMatrixNear(q * q.Transpose(), Matrix<double>::Identity(18), 1e-10,
+                     "reduction Q is orthogonal");
+    AssertMatrixNear(q * h * q.Transpose(), a, 1e-10,
+                     "Q * H * Q^T reconstructs A");
+    for (std::size_t i = 0; i < 18; ++i) {
+        for (std::size_t j = 0; j + 1 < i; ++j) {
+            AssertNear(h(i, j), 0.0, 1e-12, "H is upper Hessenberg");
+        }
+    }
+}
+
+void TestTridiagonalReduce() {
+    Matrix<double> a = RandomSymmetric(15);
+    Matrix<double> q, t;
+    TridiagonalReduce(a, q, t);
+
+    AssertMatrixNear(q * t * q.Transpose(), a, 1e-10,
+                     "Q * T * Q^T reconstructs A");
+    for (std::size_t i = 0; i < 15; ++i) {
+        for (std::size_t j = 0; j < 15; ++j) {
+            if (j + 1 < i || i + 1 < j) {
+                AssertNear(t(i, j), 0.0, 0.0, "T is exactly tridiagonal");
+            }
+        }
+    }
+}
+
+void TestRandomSymmetric() {
+    CheckEigenDecomposition(RandomSymmetric(12), 1e-9);
+    CheckEigenDecomposition(RandomSymmetric(25), 1e-8);
+}
+
+void TestKnownSpectrum() {
+    Matrix<double> a = {{2.0, 1.0, 0.0}, {1.0, 2.0, 1.0}, {0.0, 1.0, 2.0}};
+    QRAlgorithm<double> eig;
+    eig.Compute(a);
+    double sqrt2 = std::sqrt(2.0);
+    AssertNear(eig.Eigenvalues()[0], 2.0 + sqrt2, 1e-10,
+               "largest eigenvalue");
+    AssertNear(eig.Eigenvalues()[1], 2.0, 1e-10, "middle eigenvalue");
+    AssertNear(eig.Eigenvalues()[2], 2.0 - sqrt2, 1e-10,
+               "smallest eigenvalue");
+}
+
+// Clustered spectra are the pathological case for the unshifted iteration;
+// the shifted and deflating version must still converge quickly.
+void TestClusteredSpectrum() {
+    std::size_t n = 20;
+    QRDecomposition<double> qr;
+    qr.Compute(RandomMatrix(n, n));
+    const Matrix<double>& q = qr.Q();
+
+    Matrix<double> lambda(n, n);
+    for (std::size_t i = 0; i < n; ++i) {
+        // Two tight clusters around 1 and 1.001.
+        lambda(i, i) = (i < n / 2 ? 1.0 : 1.001) + 1e-9 * i;
+    }
+    Matrix<double> a = q * lambda * q.Transpose();
+
+    CheckEigenDecomposition(a, 1e-8);
+}
+
+}  // namespace
+
+int main() {
+    TestHessenbergReduce();
+    TestTridiagonalReduce();
+    TestRandomSymmetric();
+    TestKnownSpectrum();
+    TestClusteredSpectrum();
+    std::cout << "test_qr_algorithm: OK\n";
+    return 0;
+}
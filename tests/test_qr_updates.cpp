@@ -0,0 +1,160 @@
+#include <cstddef>
+#include <iostream>
+
+#include "../algorithms/qr_algorithm.h"
+#include "../algorithms/qr_updates.h"
+#include "../algorithms/randomized_svd.h"
+#include "../types/matrix.h"
+#include "test_helpers.h"
+
+using namespace linalg;
+using namespace linalg::tests;
+
+namespace {
+
+void AssertOrthonormalColumns(const Matrix<double>& q, const char* what) {
+    Matrix<double> gram = MultiplyAtB(q, q);
+    AssertMatrixNear(gram, Matrix<double>::Identity(q.Cols()), 1e-10, what);
+}
+
+void TestAppendRow() {
+    Matrix<double> a = RandomMatrix(50, 12);
+    Matrix<double> extra = RandomMatrix(5, 12);
+
+    UpdatableQR<double> qr;
+    qr.Initialize(a);
+    for (std::size_t i = 0; i < 5; ++i) {
+        qr.AppendRow(&extra(i, 0));
+    }
+
+    AssertTrue(qr.Q().Rows() == 55 && qr.Q().Cols() == 12,
+               "appended factor shape");
+    AssertOrthonormalColumns(qr.Q(), "Q stays orthonormal across appends");
+
+    Matrix<double> reconstructed = qr.Q() * qr.R();
+    for (std::size_t i = 0; i < 55; ++i) {
+        for (std::size_t j = 0; j < 12; ++j) {
+            double expected = i < 50 ? a(i, j) : extra(i - 50, j);
+            AssertNear(reconstructed(i, j), expected, 1e-10,
+                       "Q * R tracks the appended rows");
+        }
+    }
+}
+
+void TestRankOneUpdate() {
+    Matrix<double> a = RandomMatrix(40, 15);
+    Matrix<double> u = RandomMatrix(40, 1);
+    Matrix<double> v = RandomMatrix(15, 1);
+
+    UpdatableQR<double> qr;
+    qr.Initialize(a);
+    qr.RankOneUpdate(u.Data(), v.Data());
+
+    AssertOrthonormalColumns(qr.Q(), "Q stays orthonormal after update");
+    Matrix<double> reconstructed = qr.Q() * qr.R();
+    for (std::size_t i = 0; i < 40; ++i) {
+        for (std::size_t j = 0; j < 15; ++j) {
+            AssertNear(reconstructed(i, j), a(i, j) + u(i, 0) * v(j, 0),
+                       1e-10, "Q * R tracks the rank-1 update");
+        }
+    }
+}
+
+// Modifying one row in place is the e_k rank-1 special case the pipeline
+// ticks use.
+void TestRowModification() {
+    Matrix<double> a = RandomMatrix(30, 10);
+    Matrix<double> new_row = RandomMatrix(1, 10);
+
+    UpdatableQR<double> qr;
+    qr.Initialize(a);
+    Matrix<double> u(30, 1);
+    u(7, 0) = 1.0;
+    Matrix<double> delta(10, 1);
+    for (std::size_t j = 0; j < 10; ++j) {
+        delta(j, 0) = new_row(0, j) - a(7, j);
+    }
+    qr.RankOneUpdate(u.Data(), delta.Data());
+
+    Matrix<double> reconstructed = qr.Q() * qr.R();
+    for (std::size_t i = 0; i < 30; ++i) {
+        for (std::size_t j = 0; j < 10; ++j) {
+            double expected = i == 7 ? new_row(0, j) : a(i, j);
+            AssertNear(reconstructed(i, j), expected, 1e-10,
+                       "row replaced through the rank-1 path");
+        }
+    }
+}
+
+void TestWarmStartEigen() {
+    Matrix<double> base = RandomMatrix(30, 30);
+    Matrix<double> a = base + base.Transpose();
+
+    QRAlgorithm<double> cold;
+    cold.Compute(a);
+
+    // Perturb slightly and restart from the previous eigenbasis.
+    Matrix<double> perturbation = RandomMatrix(30, 30);
+    Matrix<double> b = a;
+    for (std::size_t i = 0; i < 30; ++i) {
+        for (std::size_t j = 0; j < 30; ++j) {
+            double p = 1e-3 * (perturbation(i, j) + perturbation(j, i));
+            b(i, j) += p;
+        }
+    }
+    QRAlgorithm<double> warm;
+    warm.Compute(b, cold.Eigenvectors());
+
+    QRAlgorithm<double> reference;
+    reference.Compute(b);
+    for (std::size_t i = 0; i < 30; ++i) {
+        AssertNear(warm.Eigenvalues()[i], reference.Eigenvalues()[i], 1e-9,
+                   "warm start reproduces the spectrum");
+    }
+
+    // Residual check: B v = lambda v for the warm eigenpairs.
+    Matrix<double> bv = b * warm.Eigenvectors();
+    for (std::size_t j = 0; j < 30; ++j) {
+        for (std::size_t i = 0; i < 30; ++i) {
+            AssertNear(bv(i, j),
+                       warm.Eigenvalues()[j] * warm.Eigenvectors()(i, j),
+                       1e-8, "warm eigenpairs satisfy B v = lambda v");
+        }
+    }
+}
+
+void TestWarmStartRandomizedSVD() {
+    // Exact rank-8 matrix, slowly perturbed within the same subspace.
+    Matrix<double> left = RandomMatrix(80, 8);
+    Matrix<double> right = RandomMatrix(8, 60);
+    Matrix<double> a = left * right;
+
+    RandomizedSVDOptions options;
+    auto cold = RandomizedSVD(a, 8, options);
+
+    Matrix<double> b = a * 1.01;
+    // Warm start from the previous right singular vectors with the power
+    // budget removed entirely.
+    options.power_iterations = 0;
+    auto warm = RandomizedSVD(b, 8, cold.v, options);
+
+    Matrix<double> sigma(8, 8);
+    for (std::size_t i = 0; i < 8; ++i) {
+        sigma(i, i) = warm.singular_values[i];
+    }
+    Matrix<double> reconstructed = warm.u * sigma * warm.v.Transpose();
+    AssertMatrixNear(reconstructed, b, 1e-7,
+                     "warm sketch recovers the evolved matrix");
+}
+
+}  // namespace
+
+int main() {
+    TestAppendRow();
+    TestRankOneUpdate();
+    TestRowModification();
+    TestWarmStartEigen();
+    TestWarmStartRandomizedSVD();
+    std::cout << "test_qr_updates: OK\n";
+    return 0;
+}
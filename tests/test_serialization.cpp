@@ -0,0 +1,87 @@
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <string>
+
+#include "../types/matrix.h"
+#include "../types/matrix_view.h"
+#include "../types/serialization.h"
+#include "test_helpers.h"
+
+using namespace linalg;
+using namespace linalg::tests;
+
+namespace {
+
+const std::string kPath = "serialization_test.bin";
+
+void TestRoundTrip() {
+    Matrix<double> original = RandomMatrix(37, 21);
+    AssertTrue(SaveBinary<double>(original, kPath), "save succeeds");
+
+    auto loaded = LoadBinary<double>(kPath);
+    AssertTrue(loaded.has_value(), "load succeeds");
+    AssertMatrixNear(*loaded, original, 0.0, "binary round trip is exact");
+}
+
+void TestStridedViewSave() {
+    Matrix<double> big = RandomMatrix(40, 30);
+    ConstMatrixView<double> window =
+        ConstMatrixView<double>(big).Submatrix(5, 7, 12, 9);
+    AssertTrue(SaveBinary(window, kPath), "strided view save succeeds");
+
+    auto loaded = LoadBinary<double>(kPath);
+    AssertTrue(loaded.has_value() && loaded->Rows() == 12 &&
+                   loaded->Cols() == 9,
+               "view dimensions survive the round trip");
+    for (std::size_t i = 0; i < 12; ++i) {
+        for (std::size_t j = 0; j < 9; ++j) {
+            AssertNear((*loaded)(i, j), big(5 + i, 7 + j), 0.0,
+                       "view entry survives the round trip");
+        }
+    }
+}
+
+void TestMappedLoad() {
+    Matrix<double> original = RandomMatrix(64, 48);
+    AssertTrue(SaveBinary<double>(original, kPath), "save succeeds");
+
+    auto mapped = MappedMatrix<double>::Open(kPath);
+    AssertTrue(mapped.has_value(), "mmap open succeeds");
+
+    ConstMatrixView<double> view = mapped->View();
+    AssertTrue(view.Rows() == 64 && view.Cols() == 48,
+               "mapped dimensions match");
+    AssertTrue(reinterpret_cast<std::uintptr_t>(view.Data()) % 64 == 0,
+               "mapped payload is 64-byte aligned");
+    for (std::size_t i = 0; i < 64; ++i) {
+        for (std::size_t j = 0; j < 48; ++j) {
+            AssertNear(view(i, j), original(i, j), 0.0,
+                       "mapped entry matches the saved matrix");
+        }
+    }
+}
+
+void TestTypeMismatchRejected() {
+    Matrix<double> original = RandomMatrix(8, 8);
+    AssertTrue(SaveBinary<double>(original, kPath), "save succeeds");
+
+    AssertTrue(!LoadBinary<float>(kPath).has_value(),
+               "loading with the wrong dtype fails cleanly");
+    AssertTrue(!MappedMatrix<float>::Open(kPath).has_value(),
+               "mapping with the wrong dtype fails cleanly");
+    AssertTrue(!LoadBinary<double>("missing_file.bin").has_value(),
+               "loading a missing file fails cleanly");
+}
+
+}  // namespace
+
+int main() {
+    TestRoundTrip();
+    TestStridedViewSave();
+    TestMappedLoad();
+    TestTypeMismatchRejected();
+    std::remove(kPath.c_str());
+    std::cout << "test_serialization: OK\n";
+    return 0;
+}
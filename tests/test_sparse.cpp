@@ -0,0 +1,123 @@
+#include <cstddef>
+#include <iostream>
+#include <vector>
+
+#include "../algorithms/sparse_solvers.h"
+#include "../types/matrix.h"
+#include "../types/sparse_matrix.h"
+#include "test_helpers.h"
+
+using namespace linalg;
+using namespace linalg::tests;
+
+namespace {
+
+// 1D graph Laplacian plus a small diagonal shift: sparse, symmetric,
+// positive definite — the workload shape the sparse path exists for.
+SparseMatrix<double> ShiftedLaplacian(std::size_t n) {
+    std::vector<SparseMatrix<double>::Triplet> triplets;
+    for (std::size_t i = 0; i < n; ++i) {
+        triplets.push_back({i, i, 2.1});
+        if (i + 1 < n) {
+            triplets.push_back({i, i + 1, -1.0});
+            triplets.push_back({i + 1, i, -1.0});
+        }
+    }
+    return SparseMatrix<double>::FromTriplets(n, n, std::move(triplets));
+}
+
+void TestConstructionRoundTrip() {
+    Matrix<double> dense = {{0.0, 2.0, 0.0},
+                            {1.0, 0.0, 0.0},
+                            {0.0, -3.0, 4.0}};
+    SparseMatrix<double> sparse = SparseMatrix<double>::FromDense(dense);
+    AssertTrue(sparse.NonZeros() == 4, "zeros are not stored");
+    AssertMatrixNear(sparse.ToDense(), dense, 0.0, "dense round trip");
+
+    // Triplets arrive unordered and with a duplicate that must be summed.
+    SparseMatrix<double> from_triplets = SparseMatrix<double>::FromTriplets(
+        3, 3,
+        {{2, 2, 4.0}, {0, 1, 1.5}, {1, 0, 1.0}, {2, 1, -3.0}, {0, 1, 0.5}});
+    AssertMatrixNear(from_triplets.ToDense(), dense, 0.0,
+                     "triplet construction");
+}
+
+void TestSparseDenseProducts() {
+    Matrix<double> dense = RandomMatrix(40, 30);
+    for (std::size_t i = 0; i < 40; ++i) {
+        for (std::size_t j = 0; j < 30; ++j) {
+            if ((i * 7 + j * 3) % 5 != 0) {
+                dense(i, j) = 0.0;
+            }
+        }
+    }
+    SparseMatrix<double> sparse = SparseMatrix<double>::FromDense(dense);
+    Matrix<double> b = RandomMatrix(30, 8);
+    AssertMatrixNear(sparse * b, dense * b, 1e-12, "sparse-dense GEMM");
+
+    Matrix<double> c = RandomMatrix(40, 6);
+    AssertMatrixNear(MultiplyAtB(sparse, c), MultiplyAtB(dense, c), 1e-12,
+                     "sparse adjoint product");
+}
+
+void TestConjugateGradient() {
+    const std::size_t n = 200;
+    SparseMatrix<double> a = ShiftedLaplacian(n);
+    Matrix<double> x_true = RandomMatrix(n, 1);
+    Matrix<double> b = a * x_true;
+
+    auto result = ConjugateGradient(a, b);
+    AssertTrue(result.converged, "CG converges on an SPD system");
+    AssertTrue(result.iterations < n, "CG converges in < n iterations");
+    AssertMatrixNear(result.x, x_true, 1e-8, "CG recovers the solution");
+}
+
+void TestLSQR() {
+    // Overdetermined sparse system with an exact solution.
+    Matrix<double> dense = RandomMatrix(80, 25);
+    for (std::size_t i = 0; i < 80; ++i) {
+        for (std::size_t j = 0; j < 25; ++j) {
+            if ((i + 2 * j) % 3 != 0) {
+                dense(i, j) = 0.0;
+            }
+        }
+    }
+    SparseMatrix<double> a = SparseMatrix<double>::FromDense(dense);
+    Matrix<double> x_true = RandomMatrix(25, 1);
+    Matrix<double> b = a * x_true;
+
+    auto consistent = LSQR(a, b);
+    AssertTrue(consistent.converged, "LSQR converges on a consistent system");
+    AssertMatrixNear(consistent.x, x_true, 1e-8, "LSQR recovers the solution");
+
+    // Perturb b off the column space: the minimizer satisfies the normal
+    // equations A^T (A x - b) = 0.
+    Matrix<double> noisy = b;
+    for (std::size_t i = 0; i < 80; ++i) {
+        noisy(i, 0) += 0.01 * std::cos(double(3 * i + 1));
+    }
+    auto least_squares = LSQR(a, noisy);
+    AssertTrue(least_squares.converged,
+               "LSQR converges on an inconsistent system");
+    Matrix<double> residual = noisy;
+    Matrix<double> ax = a * least_squares.x;
+    for (std::size_t i = 0; i < 80; ++i) {
+        residual(i, 0) -= ax(i, 0);
+    }
+    Matrix<double> normal = MultiplyAtB(a, residual);
+    for (std::size_t j = 0; j < 25; ++j) {
+        AssertNear(normal(j, 0), 0.0, 1e-8,
+                   "LSQR solution satisfies the normal equations");
+    }
+}
+
+}  // namespace
+
+int main() {
+    TestConstructionRoundTrip();
+    TestSparseDenseProducts();
+    TestConjugateGradient();
+    TestLSQR();
+    std::cout << "test_sparse: OK\n";
+    return 0;
+}
@@ -0,0 +1,76 @@
+#include <iostream>
+
+#include "../algorithms/householder.h"
+#include "../types/matrix.h"
+#include "test_helpers.h"
+
+using namespace linalg;
+using namespace linalg::tests;
+
+namespace {
+
+constexpr Matrix<double, 2, 2> kA = {{1.0, 2.0}, {3.0, 4.0}};
+constexpr Matrix<double, 2, 2> kB = {{0.0, 1.0}, {1.0, 0.0}};
+
+// The fixed-size arithmetic must be usable in constant expressions.
+static_assert((kA * Matrix<double, 2, 2>::Identity())(1, 0) == 3.0);
+static_assert((kA * kB)(0, 0) == 2.0);
+static_assert(kA.Transpose()(0, 1) == 3.0);
+
+void TestFixedSizeArithmetic() {
+    Matrix<double, 2, 3> a = {{1.0, 2.0, 3.0}, {4.0, 5.0, 6.0}};
+    Matrix<double, 3, 2> b = {{7.0, 8.0}, {9.0, 10.0}, {11.0, 12.0}};
+
+    Matrix<double, 2, 2> product = a * b;
+    AssertNear(product(0, 0), 58.0, 1e-15, "fixed-size product (0,0)");
+    AssertNear(product(1, 1), 154.0, 1e-15, "fixed-size product (1,1)");
+
+    Matrix<double, 2, 3> sum = a + a - 0.5 * a;
+    AssertNear(sum(1, 2), 9.0, 1e-15, "fixed-size lazy expression");
+}
+
+void TestInteropWithDynamic() {
+    Matrix<double, 3, 3> fixed = {{2.0, 0.0, 0.0},
+                                  {0.0, 3.0, 0.0},
+                                  {0.0, 0.0, 4.0}};
+    Matrix<double> dynamic = fixed;
+    AssertTrue(dynamic.Rows() == 3 && dynamic.Cols() == 3,
+               "dynamic matrix adopts the static shape");
+    AssertNear(dynamic(1, 1), 3.0, 0.0, "conversion copies elements");
+
+    Matrix<double> mixed = dynamic + fixed;
+    AssertNear(mixed(2, 2), 8.0, 1e-15,
+               "fixed and dynamic mix in one expression");
+}
+
+// The generic kernels in algorithms/ must accept fixed-size operands.
+void TestKernelsOnFixedSize() {
+    Matrix<double, 4, 4> a;
+    for (std::size_t i = 0; i < 4; ++i) {
+        for (std::size_t j = 0; j < 4; ++j) {
+            a(i, j) = static_cast<double>(i * 4 + j + 1);
+        }
+    }
+    Matrix<double> reference = a;
+
+    Householder<double> h = ComputeHouseholder(&a(0, 0), 4, 4);
+    ApplyHouseholderLeft(a, h, 0, 0);
+    ApplyHouseholderLeft(reference, h, 0, 0);
+
+    for (std::size_t i = 0; i < 4; ++i) {
+        for (std::size_t j = 0; j < 4; ++j) {
+            AssertNear(a(i, j), reference(i, j), 1e-13,
+                       "reflector application matches on fixed-size matrix");
+        }
+    }
+}
+
+}  // namespace
+
+int main() {
+    TestFixedSizeArithmetic();
+    TestInteropWithDynamic();
+    TestKernelsOnFixedSize();
+    std::cout << "test_static_matrix: OK\n";
+    return 0;
+}
@@ -0,0 +1,120 @@
+#include <atomic>
+#include <cstddef>
+#include <iostream>
+#include <numeric>
+#include <vector>
+
+#include "../algorithms/qr_algorithm.h"
+#include "../algorithms/qr_decomposition.h"
+#include "../core/task_scheduler.h"
+#include "test_helpers.h"
+
+using namespace linalg;
+using namespace linalg::tests;
+
+namespace {
+
+// Recursive divide-and-conquer sum: the spawn/sync pattern the
+// decomposition trees use, with deliberately unbalanced splits so the
+// deques actually get stolen from.
+long RecursiveSum(const std::vector<int>& values, std::size_t begin,
+                  std::size_t end) {
+    if (end - begin <= 64) {
+        long total = 0;
+        for (std::size_t i = begin; i < end; ++i) {
+            total += values[i];
+        }
+        return total;
+    }
+    // 1:3 split, not 1:1.
+    std::size_t mid = begin + (end - begin) / 4;
+    long left = 0;
+    TaskScheduler::TaskGroup group;
+    group.Spawn([&] { left = RecursiveSum(values, begin, mid); });
+    long right = RecursiveSum(values, mid, end);
+    group.Wait();
+    return left + right;
+}
+
+void TestRecursiveSpawnSync() {
+    std::vector<int> values(20000);
+    std::iota(values.begin(), values.end(), 1);
+    long expected =
+        static_cast<long>(values.size()) * (values.size() + 1) / 2;
+
+    long total = RecursiveSum(values, 0, values.size());
+    AssertTrue(total == expected, "recursive spawn/sync computes the sum");
+}
+
+void TestManySmallTasks() {
+    std::atomic<std::size_t> counter{0};
+    TaskScheduler::TaskGroup group;
+    for (std::size_t i = 0; i < 5000; ++i) {
+        group.Spawn([&] { counter.fetch_add(1); });
+    }
+    group.Wait();
+    AssertTrue(counter.load() == 5000, "every spawned task ran once");
+}
+
+void TestNestedGroups() {
+    std::atomic<std::size_t> counter{0};
+    TaskScheduler::TaskGroup outer;
+    for (std::size_t i = 0; i < 16; ++i) {
+        outer.Spawn([&] {
+            TaskScheduler::TaskGroup inner;
+            for (std::size_t j = 0; j < 32; ++j) {
+                inner.Spawn([&] { counter.fetch_add(1); });
+            }
+            inner.Wait();
+        });
+    }
+    outer.Wait();
+    AssertTrue(counter.load() == 16 * 32,
+               "nested groups complete without deadlock");
+}
+
+// A spectrum with two well-separated clusters deflates early into two
+// large independent blocks — exactly the shape that takes the parallel
+// branch of the eigensolver's recursion.
+void TestParallelDeflation() {
+    std::size_t n = 160;
+    Matrix<double> d(n, n);
+    for (std::size_t i = 0; i < n; ++i) {
+        d(i, i) = (i < n / 2 ? 1.0 : 100.0) + 1e-3 * static_cast<double>(i);
+    }
+    Matrix<double> a = RandomMatrix(n, n);
+    QRDecomposition<double> qr;
+    qr.Compute(a);
+    Matrix<double> similar = qr.Q() * d * qr.Q().Transpose();
+    // Symmetrize against roundoff.
+    similar = 0.5 * (similar + similar.Transpose());
+
+    QRAlgorithm<double> eigen;
+    eigen.Compute(similar);
+
+    const auto& lambda = eigen.Eigenvalues();
+    for (std::size_t i = 0; i < n; ++i) {
+        std::size_t source = n - 1 - i;
+        double expected = (source < n / 2 ? 1.0 : 100.0) +
+                          1e-3 * static_cast<double>(source);
+        AssertNear(lambda[i], expected, 1e-7,
+                   "clustered spectrum recovered through parallel blocks");
+    }
+
+    AssertMatrixNear(eigen.Eigenvectors() *
+                         eigen.Eigenvectors().Transpose(),
+                     Matrix<double>::Identity(n), 1e-9,
+                     "eigenvectors stay orthogonal across parallel blocks");
+}
+
+}  // namespace
+
+int main() {
+    TaskScheduler::SetGlobalThreadCount(4);
+    TestRecursiveSpawnSync();
+    TestManySmallTasks();
+    TestNestedGroups();
+    TestParallelDeflation();
+    std::cout << "test_task_scheduler: OK\n";
+    return 0;
+}
@@ -0,0 +1,81 @@
+#include <cstdint>
+#include <iostream>
+
+#include "../algorithms/qr_decomposition.h"
+#include "../algorithms/svd.h"
+#include "../core/workspace.h"
+#include "test_helpers.h"
+
+using namespace linalg;
+using namespace linalg::tests;
+
+namespace {
+
+void TestArenaBasics() {
+    Workspace ws;
+    double* a = ws.Allocate<double>(100);
+    AssertTrue(reinterpret_cast<std::uintptr_t>(a) % 64 == 0,
+               "allocations are 64-byte aligned");
+    double* b = ws.Allocate<double>(100);
+    AssertTrue(a != b, "distinct allocations do not overlap");
+
+    ws.Reset();
+    double* c = ws.Allocate<double>(100);
+    AssertTrue(c == a, "Reset rewinds to the start of the arena");
+}
+
+void TestMarkRewind() {
+    Workspace ws;
+    ws.Allocate<double>(10);
+    Workspace::Marker marker = ws.Mark();
+    double* first = ws.Allocate<double>(50);
+    ws.Rewind(marker);
+    double* second = ws.Allocate<double>(50);
+    AssertTrue(first == second, "Rewind releases everything past the mark");
+}
+
+void TestCapacityStabilizes() {
+    Workspace ws;
+    Matrix<double> a = RandomMatrix(60, 40);
+    QRDecomposition<double> qr;
+
+    qr.Compute(a, &ws);
+    std::size_t warm_capacity = ws.CapacityBytes();
+    AssertTrue(warm_capacity > 0, "workspace is actually used");
+
+    for (int i = 0; i < 5; ++i) {
+        qr.Compute(a, &ws);
+    }
+    AssertTrue(ws.CapacityBytes() == warm_capacity,
+               "no arena growth after the warm-up call");
+}
+
+void TestDecompositionsMatchWithWorkspace() {
+    Matrix<double> a = RandomMatrix(40, 25);
+    Workspace ws;
+
+    QRDecomposition<double> qr_plain;
+    QRDecomposition<double> qr_ws;
+    qr_plain.Compute(a);
+    qr_ws.Compute(a, &ws);
+    AssertMatrixNear(qr_ws.Q(), qr_plain.Q(), 1e-14,
+                     "workspace QR matches plain QR (Q)");
+    AssertMatrixNear(qr_ws.R(), qr_plain.R(), 1e-14,
+                     "workspace QR matches plain QR (R)");
+
+    SVDDecomposition<double> svd;
+    svd.Compute(a, &ws);
+    AssertMatrixNear(svd.U() * svd.SigmaMatrix() * svd.V().Transpose(), a,
+                     1e-9, "workspace SVD reconstructs A");
+}
+
+}  // namespace
+
+int main() {
+    TestArenaBasics();
+    TestMarkRewind();
+    TestCapacityStabilizes();
+    TestDecompositionsMatchWithWorkspace();
+    std::cout << "test_workspace: OK\n";
+    return 0;
+}
@@ -0,0 +1,158 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <vector>
+
+#include "../core/simd.h"
+#include "matrix.h"
+
+namespace linalg {
+
+// Square banded matrix storing only the (lower + upper + 1) diagonals, in
+// LAPACK band layout: entry (i, j) lives at row (upper + i - j) of a
+// (lower + upper + 1) x n panel. The bidiagonal and tridiagonal
+// intermediates inside the SVD and eigenvalue drivers fit in O(n) storage
+// this way instead of O(n^2), and the band kernels below never touch a
+// structural zero.
+template <typename T>
+class BandedMatrix {
+public:
+    BandedMatrix() = default;
+
+    BandedMatrix(std::size_t n, std::size_t lower, std::size_t upper)
+        : n_(n),
+          lower_(lower),
+          upper_(upper),
+          data_((lower + upper + 1) * n, T{}) {}
+
+    // Packs the band of a dense matrix; entries outside the band are
+    // ignored, not checked.
+    static BandedMatrix FromDense(const Matrix<T>& dense, std::size_t lower,
+                                  std::size_t upper) {
+        assert(dense.Rows() == dense.Cols());
+        BandedMatrix result(dense.Rows(), lower, upper);
+        for (std::size_t i = 0; i < result.n_; ++i) {
+            std::size_t j_begin = i > lower ? i - lower : 0;
+            std::size_t j_end = std::min(result.n_, i + upper + 1);
+            for (std::size_t j = j_begin; j < j_end; ++j) {
+                result.At(i, j) = dense(i, j);
+            }
+        }
+        return result;
+    }
+
+    std::size_t Rows() const {
+        return n_;
+    }
+
+    std::size_t Cols() const {
+        return n_;
+    }
+
+    std::size_t LowerBandwidth() const {
+        return lower_;
+    }
+
+    std::size_t UpperBandwidth() const {
+        return upper_;
+    }
+
+    // Value read: zero outside the band.
+    T operator()(std::size_t i, std::size_t j) const {
+        assert(i < n_ && j < n_);
+        if (Outside(i, j)) {
+            return T{};
+        }
+        return data_[Index(i, j)];
+    }
+
+    // Mutable access, valid only within the band.
+    T& At(std::size_t i, std::size_t j) {
+        assert(i < n_ && j < n_ && !Outside(i, j));
+        return data_[Index(i, j)];
+    }
+
+    Matrix<T> ToDense() const {
+        Matrix<T> result(n_, n_);
+        for (std::size_t i = 0; i < n_; ++i) {
+            std::size_t j_begin = i > lower_ ? i - lower_ : 0;
+            std::size_t j_end = std::min(n_, i + upper_ + 1);
+            for (std::size_t j = j_begin; j < j_end; ++j) {
+                result(i, j) = data_[Index(i, j)];
+            }
+        }
+        return result;
+    }
+
+    // Multi-RHS substitution solve of B * X = R for triangular bands (one of
+    // the bandwidths zero), which covers the bidiagonal systems the drivers
+    // produce. O(n * bandwidth * rhs) instead of O(n^2 * rhs).
+    Matrix<T> Solve(Matrix<T> rhs) const {
+        assert(rhs.Rows() == n_);
+        assert((lower_ == 0 || upper_ == 0) &&
+               "band solve requires a triangular band");
+        std::size_t width = rhs.Cols();
+        if (lower_ == 0) {
+            for (std::size_t i = n_; i-- > 0;) {
+                std::size_t j_end = std::min(n_, i + upper_ + 1);
+                for (std::size_t j = i + 1; j < j_end; ++j) {
+                    simd::Axpy(-data_[Index(i, j)], &rhs(j, 0), &rhs(i, 0),
+                               width);
+                }
+                Scale(&rhs(i, 0), width, data_[Index(i, i)]);
+            }
+        } else {
+            for (std::size_t i = 0; i < n_; ++i) {
+                std::size_t j_begin = i > lower_ ? i - lower_ : 0;
+                for (std::size_t j = j_begin; j < i; ++j) {
+                    simd::Axpy(-data_[Index(i, j)], &rhs(j, 0), &rhs(i, 0),
+                               width);
+                }
+                Scale(&rhs(i, 0), width, data_[Index(i, i)]);
+            }
+        }
+        return rhs;
+    }
+
+    // C = B * D touching only the band of B.
+    friend Matrix<T> operator*(const BandedMatrix& lhs,
+                               const Matrix<T>& rhs) {
+        assert(lhs.n_ == rhs.Rows());
+        std::size_t width = rhs.Cols();
+        Matrix<T> result(lhs.n_, width);
+        for (std::size_t i = 0; i < lhs.n_; ++i) {
+            std::size_t j_begin = i > lhs.lower_ ? i - lhs.lower_ : 0;
+            std::size_t j_end = std::min(lhs.n_, i + lhs.upper_ + 1);
+            for (std::size_t j = j_begin; j < j_end; ++j) {
+                simd::Axpy(lhs.data_[lhs.Index(i, j)], &rhs(j, 0),
+                           &result(i, 0), width);
+            }
+        }
+        return result;
+    }
+
+private:
+    bool Outside(std::size_t i, std::size_t j) const {
+        return j + lower_ < i || i + upper_ < j;
+    }
+
+    std::size_t Index(std::size_t i, std::size_t j) const {
+        return (upper_ + i - j) * n_ + j;
+    }
+
+    static void Scale(T* row, std::size_t width, T pivot) {
+        assert(pivot != T{});
+        for (std::size_t j = 0; j < width; ++j) {
+            row[j] /= pivot;
+        }
+    }
+
+    std::size_t n_ = 0;
+    std::size_t lower_ = 0;
+    std::size_t upper_ = 0;
+    std::vector<T> data_;
+};
+
+}  // namespace linalg
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+
+namespace linalg {
+
+// CRTP base for everything that can appear in a lazy matrix expression.
+// Matrix<T> and the expression nodes below all derive from it, so the
+// arithmetic operators compose matrices and subexpressions freely; nothing is
+// evaluated until the expression is assigned to a Matrix, which walks it in a
+// single pass.
+//
+// Expression nodes hold their operands by reference. Evaluate expressions in
+// the statement that builds them (assign to a Matrix); storing one in `auto`
+// past the full expression dangles.
+template <typename Derived>
+class MatrixExpression {
+public:
+    const Derived& Self() const {
+        return static_cast<const Derived&>(*this);
+    }
+};
+
+namespace detail {
+
+struct AddOp {
+    template <typename T>
+    static T Apply(T lhs, T rhs) {
+        return lhs + rhs;
+    }
+};
+
+struct SubOp {
+    template <typename T>
+    static T Apply(T lhs, T rhs) {
+        return lhs - rhs;
+    }
+};
+
+}  // namespace detail
+
+template <typename L, typename R, typename Op>
+class ElementwiseExpression
+    : public MatrixExpression<ElementwiseExpression<L, R, Op>> {
+public:
+    using ValueType = typename L::ValueType;
+
+    ElementwiseExpression(const L& lhs, const R& rhs)
+        : lhs_(lhs), rhs_(rhs) {
+        assert(lhs.Rows() == rhs.Rows() && lhs.Cols() == rhs.Cols());
+    }
+
+    std::size_t Rows() const {
+        return lhs_.Rows();
+    }
+
+    std::size_t Cols() const {
+        return lhs_.Cols();
+    }
+
+    ValueType operator()(std::size_t i, std::size_t j) const {
+        return Op::Apply(lhs_(i, j), rhs_(i, j));
+    }
+
+private:
+    const L& lhs_;
+    const R& rhs_;
+};
+
+template <typename E>
+class ScaledExpression : public MatrixExpression<ScaledExpression<E>> {
+public:
+    using ValueType = typename E::ValueType;
+
+    ScaledExpression(ValueType scalar, const E& expr)
+        : scalar_(scalar), expr_(expr) {}
+
+    std::size_t Rows() const {
+        return expr_.Rows();
+    }
+
+    std::size_t Cols() const {
+        return expr_.Cols();
+    }
+
+    ValueType operator()(std::size_t i, std::size_t j) const {
+        return scalar_ * expr_(i, j);
+    }
+
+private:
+    ValueType scalar_;
+    const E& expr_;
+};
+
+template <typename L, typename R>
+ElementwiseExpression<L, R, detail::AddOp> operator+(
+    const MatrixExpression<L>& lhs, const MatrixExpression<R>& rhs) {
+    return {lhs.Self(), rhs.Self()};
+}
+
+template <typename L, typename R>
+ElementwiseExpression<L, R, detail::SubOp> operator-(
+    const MatrixExpression<L>& lhs, const MatrixExpression<R>& rhs) {
+    return {lhs.Self(), rhs.Self()};
+}
+
+template <typename E>
+ScaledExpression<E> operator*(typename E::ValueType scalar,
+                              const MatrixExpression<E>& expr) {
+    return {scalar, expr.Self()};
+}
+
+template <typename E>
+ScaledExpression<E> operator*(const MatrixExpression<E>& expr,
+                              typename E::ValueType scalar) {
+    return {scalar, expr.Self()};
+}
+
+}  // namespace linalg
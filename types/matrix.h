@@ -0,0 +1,702 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <ostream>
+#include <utility>
+#include <vector>
+
+#include "../core/kernel_registry.h"
+#include "../core/numa.h"
+#include "../core/simd.h"
+#include "expressions.h"
+
+namespace linalg {
+
+// Sentinel for a dimension fixed only at runtime. Matrix<T> defaults both
+// dimensions to it and resolves to the heap-backed specialization below;
+// Matrix<T, N, M> with positive N, M is the stack-backed fixed-size variant.
+inline constexpr int kDynamic = -1;
+
+// Storage-order policy. Row-major is the default everywhere; column-major
+// exists for the column-access-dominated factorizations, whose reflector
+// sweeps walk columns with unit stride in that layout.
+enum class Layout {
+    kRowMajor,
+    kColMajor,
+};
+
+template <typename T, int StaticRows = kDynamic, int StaticCols = kDynamic,
+          Layout StorageLayout = Layout::kRowMajor>
+class Matrix;
+
+namespace detail {
+
+// Layout of a matrix-like type, for kernels that pick their loop order by
+// storage direction. Types without a kLayout member (views, expressions)
+// are row-major.
+template <typename MatrixT>
+constexpr bool IsColumnMajor() {
+    if constexpr (requires { MatrixT::kLayout; }) {
+        return MatrixT::kLayout == Layout::kColMajor;
+    } else {
+        return false;
+    }
+}
+
+// Tuning constants for the blocked multiplication path. The cache blocks are
+// sized so one packed panel of B (kBlockK x kBlockN) and the active rows of A
+// stay resident in L1/L2 while the microkernel runs.
+inline constexpr std::size_t kGemmDispatchThreshold = 48;
+inline constexpr std::size_t kBlockM = 64;
+inline constexpr std::size_t kBlockN = 256;
+inline constexpr std::size_t kBlockK = 128;
+inline constexpr std::size_t kMicroM = simd::kMicroM;
+inline constexpr std::size_t kMicroN = simd::kMicroN;
+
+// Square tile edge for the blocked transpose: a 32 x 32 double tile is 8 KiB,
+// so the source rows and destination columns of one tile stay resident while
+// it is flipped, instead of every write landing on a fresh page.
+inline constexpr std::size_t kTransposeBlock = 32;
+
+// Out-of-place blocked transpose: dst (n x m) = src^T for row-major src
+// (m x n). Walks the matrix in square tiles so both the unit-stride reads and
+// the strided writes stay within one tile's worth of cache lines.
+template <typename T>
+void BlockedTranspose(const T* src, T* dst, std::size_t m, std::size_t n) {
+    for (std::size_t ib = 0; ib < m; ib += kTransposeBlock) {
+        std::size_t i_end = std::min(ib + kTransposeBlock, m);
+        for (std::size_t jb = 0; jb < n; jb += kTransposeBlock) {
+            std::size_t j_end = std::min(jb + kTransposeBlock, n);
+            for (std::size_t i = ib; i < i_end; ++i) {
+                for (std::size_t j = jb; j < j_end; ++j) {
+                    dst[j * m + i] = src[i * n + j];
+                }
+            }
+        }
+    }
+}
+
+// Copies a kc x nc block of B (leading dimension ldb) into a contiguous
+// buffer laid out as kMicroN-wide column strips, so the microkernel reads it
+// with unit stride regardless of the original matrix width.
+template <typename T>
+void PackPanelB(const T* b, std::size_t ldb, std::size_t kc, std::size_t nc,
+                T* packed) {
+    for (std::size_t j = 0; j < nc; j += kMicroN) {
+        std::size_t nr = std::min(kMicroN, nc - j);
+        for (std::size_t p = 0; p < kc; ++p) {
+            for (std::size_t jj = 0; jj < nr; ++jj) {
+                *packed++ = b[p * ldb + j + jj];
+            }
+            for (std::size_t jj = nr; jj < kMicroN; ++jj) {
+                *packed++ = T{};
+            }
+        }
+    }
+}
+
+// Computes a kMicroM x kMicroN tile of C += A * B with the accumulators held
+// in registers. A is read in place (row-major, leading dimension lda); B comes
+// from the packed panel produced by PackPanelB. The arithmetic lives in the
+// kernel registry, which binds the widest ISA variant the host supports.
+template <typename T>
+void MicroKernel(const T* a, std::size_t lda, const T* b_packed, T* c,
+                 std::size_t ldc, std::size_t kc, std::size_t mr,
+                 std::size_t nr) {
+    simd::MicroKernel(a, lda, b_packed, c, ldc, kc, mr, nr);
+}
+
+// Cache-tiled C += A * B for row-major operands: loops over kBlockN-wide
+// column panels and kBlockK-deep slices, packs the B panel once, then sweeps
+// kBlockM rows of A through it with the register-tiled microkernel.
+template <typename T>
+void BlockedMultiply(const T* a, const T* b, T* c, std::size_t m,
+                     std::size_t n, std::size_t k) {
+    std::vector<T> packed(kBlockK * (kBlockN + kMicroN));
+    for (std::size_t jc = 0; jc < n; jc += kBlockN) {
+        std::size_t nc = std::min(kBlockN, n - jc);
+        for (std::size_t pc = 0; pc < k; pc += kBlockK) {
+            std::size_t kc = std::min(kBlockK, k - pc);
+            PackPanelB(b + pc * n + jc, n, kc, nc, packed.data());
+            for (std::size_t ic = 0; ic < m; ic += kBlockM) {
+                std::size_t mc = std::min(kBlockM, m - ic);
+                for (std::size_t jr = 0; jr < nc; jr += kMicroN) {
+                    std::size_t nr = std::min(kMicroN, nc - jr);
+                    const T* b_strip = packed.data() + jr * kc;
+                    for (std::size_t ir = 0; ir < mc; ir += kMicroM) {
+                        std::size_t mr = std::min(kMicroM, mc - ir);
+                        MicroKernel(a + (ic + ir) * k + pc, k, b_strip,
+                                    c + (ic + ir) * n + jc + jr, n, kc, mr,
+                                    nr);
+                    }
+                }
+            }
+        }
+    }
+}
+
+// Reference triple loop, kept for matrices small enough that blocking and
+// packing overhead would dominate.
+template <typename T>
+void NaiveMultiply(const T* a, const T* b, T* c, std::size_t m, std::size_t n,
+                   std::size_t k) {
+    for (std::size_t i = 0; i < m; ++i) {
+        for (std::size_t p = 0; p < k; ++p) {
+            T a_ip = a[i * k + p];
+            for (std::size_t j = 0; j < n; ++j) {
+                c[i * n + j] += a_ip * b[p * n + j];
+            }
+        }
+    }
+}
+
+// Packs an mc x kc tile of A^T (A row-major with leading dimension lda) so
+// the microkernel can read it exactly as it reads an in-place row-major A
+// tile. The source is walked along A's rows, so the reads are unit stride
+// and the transposition cost is absorbed into one linear pass.
+template <typename T>
+void PackTileATrans(const T* a, std::size_t lda, std::size_t kc,
+                    std::size_t mc, T* packed) {
+    for (std::size_t p = 0; p < kc; ++p) {
+        for (std::size_t i = 0; i < mc; ++i) {
+            packed[i * kc + p] = a[p * lda + i];
+        }
+    }
+}
+
+// Packs a kc x nc panel of B^T (B row-major with leading dimension ldb) into
+// the same strip layout PackPanelB produces, reading along B's rows.
+template <typename T>
+void PackPanelBTrans(const T* b, std::size_t ldb, std::size_t kc,
+                     std::size_t nc, T* packed) {
+    for (std::size_t j = 0; j < nc; j += kMicroN) {
+        std::size_t nr = std::min(kMicroN, nc - j);
+        for (std::size_t p = 0; p < kc; ++p) {
+            for (std::size_t jj = 0; jj < nr; ++jj) {
+                *packed++ = b[(j + jj) * ldb + p];
+            }
+            for (std::size_t jj = nr; jj < kMicroN; ++jj) {
+                *packed++ = T{};
+            }
+        }
+    }
+}
+
+// C += A^T * B for a row-major k x m operand A and k x n operand B. The loop
+// structure mirrors BlockedMultiply; the only difference is that the active
+// A tile is packed transposed instead of read in place, so A is never
+// materialized column-major.
+template <typename T>
+void BlockedMultiplyTransA(const T* a, const T* b, T* c, std::size_t m,
+                           std::size_t n, std::size_t k) {
+    std::vector<T> packed_b(kBlockK * (kBlockN + kMicroN));
+    std::vector<T> packed_a(kBlockM * kBlockK);
+    for (std::size_t jc = 0; jc < n; jc += kBlockN) {
+        std::size_t nc = std::min(kBlockN, n - jc);
+        for (std::size_t pc = 0; pc < k; pc += kBlockK) {
+            std::size_t kc = std::min(kBlockK, k - pc);
+            PackPanelB(b + pc * n + jc, n, kc, nc, packed_b.data());
+            for (std::size_t ic = 0; ic < m; ic += kBlockM) {
+                std::size_t mc = std::min(kBlockM, m - ic);
+                PackTileATrans(a + pc * m + ic, m, kc, mc, packed_a.data());
+                for (std::size_t jr = 0; jr < nc; jr += kMicroN) {
+                    std::size_t nr = std::min(kMicroN, nc - jr);
+                    const T* b_strip = packed_b.data() + jr * kc;
+                    for (std::size_t ir = 0; ir < mc; ir += kMicroM) {
+                        std::size_t mr = std::min(kMicroM, mc - ir);
+                        MicroKernel(packed_a.data() + ir * kc, kc, b_strip,
+                                    c + (ic + ir) * n + jc + jr, n, kc, mr,
+                                    nr);
+                    }
+                }
+            }
+        }
+    }
+}
+
+// C += A * B^T for row-major m x k A and n x k B: the B panel is packed
+// transposed, after which the sweep is identical to BlockedMultiply.
+template <typename T>
+void BlockedMultiplyTransB(const T* a, const T* b, T* c, std::size_t m,
+                           std::size_t n, std::size_t k) {
+    std::vector<T> packed(kBlockK * (kBlockN + kMicroN));
+    for (std::size_t jc = 0; jc < n; jc += kBlockN) {
+        std::size_t nc = std::min(kBlockN, n - jc);
+        for (std::size_t pc = 0; pc < k; pc += kBlockK) {
+            std::size_t kc = std::min(kBlockK, k - pc);
+            PackPanelBTrans(b + jc * k + pc, k, kc, nc, packed.data());
+            for (std::size_t ic = 0; ic < m; ic += kBlockM) {
+                std::size_t mc = std::min(kBlockM, m - ic);
+                for (std::size_t jr = 0; jr < nc; jr += kMicroN) {
+                    std::size_t nr = std::min(kMicroN, nc - jr);
+                    const T* b_strip = packed.data() + jr * kc;
+                    for (std::size_t ir = 0; ir < mc; ir += kMicroM) {
+                        std::size_t mr = std::min(kMicroM, mc - ir);
+                        MicroKernel(a + (ic + ir) * k + pc, k, b_strip,
+                                    c + (ic + ir) * n + jc + jr, n, kc, mr,
+                                    nr);
+                    }
+                }
+            }
+        }
+    }
+}
+
+// Small-operand fallbacks, with loop orders keeping the inner stride unit.
+template <typename T>
+void NaiveMultiplyTransA(const T* a, const T* b, T* c, std::size_t m,
+                         std::size_t n, std::size_t k) {
+    for (std::size_t p = 0; p < k; ++p) {
+        for (std::size_t i = 0; i < m; ++i) {
+            simd::Axpy(a[p * m + i], b + p * n, c + i * n, n);
+        }
+    }
+}
+
+template <typename T>
+void NaiveMultiplyTransB(const T* a, const T* b, T* c, std::size_t m,
+                         std::size_t n, std::size_t k) {
+    for (std::size_t i = 0; i < m; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+            c[i * n + j] = simd::Dot(a + i * k, b + j * k, k);
+        }
+    }
+}
+
+}  // namespace detail
+
+// Fixed-size matrix: dimensions are template parameters, storage lives on
+// the stack, and every operation is constexpr-evaluable, so small geometry
+// kernels (3x3, 4x4) pay neither allocation nor runtime loop bounds. The
+// interface mirrors the dynamic specialization below, and both participate
+// in the same lazy expressions, so generic code in algorithms/ compiles
+// against either.
+template <typename T, int StaticRows, int StaticCols, Layout StorageLayout>
+class Matrix
+    : public MatrixExpression<
+          Matrix<T, StaticRows, StaticCols, StorageLayout>> {
+    static_assert(StaticRows > 0 && StaticCols > 0,
+                  "fixed-size matrix dimensions must be positive");
+
+public:
+    using ValueType = T;
+    static constexpr Layout kLayout = StorageLayout;
+
+    constexpr Matrix() : data_{} {}
+
+    constexpr Matrix(std::initializer_list<std::initializer_list<T>> list)
+        : data_{} {
+        assert(list.size() == static_cast<std::size_t>(StaticRows));
+        std::size_t i = 0;
+        for (const auto& row : list) {
+            assert(row.size() == static_cast<std::size_t>(StaticCols));
+            std::size_t j = 0;
+            for (const T& value : row) {
+                data_[Index(i, j)] = value;
+                ++j;
+            }
+            ++i;
+        }
+    }
+
+    // Evaluates a lazy expression; the shape must match the static one.
+    template <typename E>
+    constexpr Matrix(const MatrixExpression<E>& expr) : data_{} {
+        *this = expr;
+    }
+
+    template <typename E>
+    constexpr Matrix& operator=(const MatrixExpression<E>& expr) {
+        const E& e = expr.Self();
+        assert(e.Rows() == Rows() && e.Cols() == Cols());
+        for (std::size_t i = 0; i < Rows(); ++i) {
+            for (std::size_t j = 0; j < Cols(); ++j) {
+                data_[Index(i, j)] = e(i, j);
+            }
+        }
+        return *this;
+    }
+
+    static constexpr Matrix Identity() {
+        static_assert(StaticRows == StaticCols,
+                      "identity requires a square matrix");
+        Matrix result;
+        for (int i = 0; i < StaticRows; ++i) {
+            result(i, i) = T{1};
+        }
+        return result;
+    }
+
+    constexpr std::size_t Rows() const {
+        return static_cast<std::size_t>(StaticRows);
+    }
+
+    constexpr std::size_t Cols() const {
+        return static_cast<std::size_t>(StaticCols);
+    }
+
+    constexpr T* Data() {
+        return data_.data();
+    }
+
+    constexpr const T* Data() const {
+        return data_.data();
+    }
+
+    constexpr T& operator()(std::size_t i, std::size_t j) {
+        assert(i < Rows() && j < Cols());
+        return data_[Index(i, j)];
+    }
+
+    constexpr const T& operator()(std::size_t i, std::size_t j) const {
+        assert(i < Rows() && j < Cols());
+        return data_[Index(i, j)];
+    }
+
+    constexpr Matrix& operator+=(const Matrix& other) {
+        for (std::size_t i = 0; i < data_.size(); ++i) {
+            data_[i] += other.data_[i];
+        }
+        return *this;
+    }
+
+    constexpr Matrix& operator-=(const Matrix& other) {
+        for (std::size_t i = 0; i < data_.size(); ++i) {
+            data_[i] -= other.data_[i];
+        }
+        return *this;
+    }
+
+    constexpr Matrix& operator*=(T scalar) {
+        for (T& value : data_) {
+            value *= scalar;
+        }
+        return *this;
+    }
+
+    constexpr Matrix<T, StaticCols, StaticRows, StorageLayout> Transpose()
+        const {
+        Matrix<T, StaticCols, StaticRows, StorageLayout> result;
+        for (std::size_t i = 0; i < Rows(); ++i) {
+            for (std::size_t j = 0; j < Cols(); ++j) {
+                result(j, i) = (*this)(i, j);
+            }
+        }
+        return result;
+    }
+
+    friend constexpr bool operator==(const Matrix& lhs, const Matrix& rhs) {
+        return lhs.data_ == rhs.data_;
+    }
+
+    friend std::ostream& operator<<(std::ostream& out, const Matrix& matrix) {
+        for (std::size_t i = 0; i < matrix.Rows(); ++i) {
+            for (std::size_t j = 0; j < matrix.Cols(); ++j) {
+                out << matrix(i, j) << (j + 1 == matrix.Cols() ? "" : " ");
+            }
+            out << '\n';
+        }
+        return out;
+    }
+
+private:
+    static constexpr std::size_t Index(std::size_t i, std::size_t j) {
+        if constexpr (StorageLayout == Layout::kRowMajor) {
+            return i * StaticCols + j;
+        } else {
+            return i + j * StaticRows;
+        }
+    }
+
+    std::array<T, static_cast<std::size_t>(StaticRows) *
+                      static_cast<std::size_t>(StaticCols)>
+        data_;
+};
+
+// Fixed-size product with statically checked inner dimensions; the loop
+// bounds are compile-time constants, so the compiler fully unrolls and
+// vectorizes the kernel.
+template <typename T, int N, int K, int M>
+constexpr Matrix<T, N, M> operator*(const Matrix<T, N, K>& lhs,
+                                    const Matrix<T, K, M>& rhs) {
+    Matrix<T, N, M> result;
+    for (int i = 0; i < N; ++i) {
+        for (int p = 0; p < K; ++p) {
+            T a_ip = lhs(i, p);
+            for (int j = 0; j < M; ++j) {
+                result(i, j) += a_ip * rhs(p, j);
+            }
+        }
+    }
+    return result;
+}
+
+// Dense matrix with runtime dimensions; the storage order is the layout
+// policy, row-major by default.
+template <typename T, Layout StorageLayout>
+class Matrix<T, kDynamic, kDynamic, StorageLayout>
+    : public MatrixExpression<Matrix<T, kDynamic, kDynamic, StorageLayout>> {
+public:
+    using ValueType = T;
+    static constexpr Layout kLayout = StorageLayout;
+
+    Matrix() = default;
+
+    Matrix(std::size_t rows, std::size_t cols)
+        : rows_(rows), cols_(cols), data_(rows * cols, T{}) {}
+
+    Matrix(std::initializer_list<std::initializer_list<T>> list)
+        : rows_(list.size()),
+          cols_(list.begin()->size()),
+          data_(rows_ * cols_) {
+        std::size_t i = 0;
+        for (const auto& row : list) {
+            assert(row.size() == cols_);
+            std::size_t j = 0;
+            for (const T& value : row) {
+                data_[Index(i, j)] = value;
+                ++j;
+            }
+            ++i;
+        }
+    }
+
+    // Evaluates a lazy expression into fresh storage in one pass.
+    template <typename E>
+    Matrix(const MatrixExpression<E>& expr)
+        : rows_(expr.Self().Rows()),
+          cols_(expr.Self().Cols()),
+          data_(rows_ * cols_) {
+        const E& e = expr.Self();
+        for (std::size_t i = 0; i < rows_; ++i) {
+            for (std::size_t j = 0; j < cols_; ++j) {
+                data_[Index(i, j)] = e(i, j);
+            }
+        }
+    }
+
+    // Evaluates a lazy expression into existing storage, reallocating only on
+    // a shape change. Elementwise expressions may alias the destination
+    // (e.g. A = A + B): entries are written in the same order they are read.
+    template <typename E>
+    Matrix& operator=(const MatrixExpression<E>& expr) {
+        const E& e = expr.Self();
+        std::size_t rows = e.Rows();
+        std::size_t cols = e.Cols();
+        if (rows != rows_ || cols != cols_) {
+            rows_ = rows;
+            cols_ = cols;
+            data_.resize(rows * cols);
+        }
+        for (std::size_t i = 0; i < rows; ++i) {
+            for (std::size_t j = 0; j < cols; ++j) {
+                data_[Index(i, j)] = e(i, j);
+            }
+        }
+        return *this;
+    }
+
+    Matrix(const Matrix&) = default;
+    Matrix& operator=(const Matrix&) = default;
+
+    // Moves must be noexcept so decomposition outputs travel through return
+    // paths and containers without falling back to copies.
+    Matrix(Matrix&& other) noexcept
+        : rows_(std::exchange(other.rows_, 0)),
+          cols_(std::exchange(other.cols_, 0)),
+          data_(std::move(other.data_)) {}
+
+    Matrix& operator=(Matrix&& other) noexcept {
+        rows_ = std::exchange(other.rows_, 0);
+        cols_ = std::exchange(other.cols_, 0);
+        data_ = std::move(other.data_);
+        return *this;
+    }
+
+    static Matrix Identity(std::size_t n) {
+        Matrix result(n, n);
+        for (std::size_t i = 0; i < n; ++i) {
+            result(i, i) = T{1};
+        }
+        return result;
+    }
+
+    // Reshapes to rows x cols of zeroes, reusing the existing storage when
+    // its capacity already suffices.
+    void Resize(std::size_t rows, std::size_t cols) {
+        rows_ = rows;
+        cols_ = cols;
+        data_.assign(rows * cols, T{});
+    }
+
+    // Turns the matrix into the n x n identity in place.
+    void SetIdentity(std::size_t n) {
+        Resize(n, n);
+        for (std::size_t i = 0; i < n; ++i) {
+            data_[i * n + i] = T{1};
+        }
+    }
+
+    std::size_t Rows() const {
+        return rows_;
+    }
+
+    std::size_t Cols() const {
+        return cols_;
+    }
+
+    T* Data() {
+        return data_.data();
+    }
+
+    const T* Data() const {
+        return data_.data();
+    }
+
+    T& operator()(std::size_t i, std::size_t j) {
+        assert(i < rows_ && j < cols_);
+        return data_[Index(i, j)];
+    }
+
+    const T& operator()(std::size_t i, std::size_t j) const {
+        assert(i < rows_ && j < cols_);
+        return data_[Index(i, j)];
+    }
+
+    Matrix& operator+=(const Matrix& other) {
+        assert(rows_ == other.rows_ && cols_ == other.cols_);
+        for (std::size_t i = 0; i < data_.size(); ++i) {
+            data_[i] += other.data_[i];
+        }
+        return *this;
+    }
+
+    Matrix& operator-=(const Matrix& other) {
+        assert(rows_ == other.rows_ && cols_ == other.cols_);
+        for (std::size_t i = 0; i < data_.size(); ++i) {
+            data_[i] -= other.data_[i];
+        }
+        return *this;
+    }
+
+    Matrix& operator*=(T scalar) {
+        for (auto& value : data_) {
+            value *= scalar;
+        }
+        return *this;
+    }
+
+    // Matrix product. Small operands go through the reference triple loop;
+    // anything larger dispatches to the cache-tiled kernel with a packed B
+    // panel, which keeps throughput flat well past the L2 working-set size.
+    // Column-major operands reuse the same row-major kernels through the
+    // identity C^T = B^T * A^T: a column-major buffer read row-major is the
+    // transpose, so swapping the operands is all it takes.
+    friend Matrix operator*(const Matrix& lhs, const Matrix& rhs) {
+        assert(lhs.cols_ == rhs.rows_);
+        Matrix result(lhs.rows_, rhs.cols_);
+        std::size_t m = lhs.rows_;
+        std::size_t n = rhs.cols_;
+        std::size_t k = lhs.cols_;
+        const T* a = lhs.Data();
+        const T* b = rhs.Data();
+        if constexpr (StorageLayout == Layout::kColMajor) {
+            std::swap(a, b);
+            std::swap(m, n);
+        }
+        if (std::max({m, n, k}) < detail::kGemmDispatchThreshold) {
+            detail::NaiveMultiply(a, b, result.Data(), m, n, k);
+        } else {
+            detail::BlockedMultiply(a, b, result.Data(), m, n, k);
+        }
+        return result;
+    }
+
+    Matrix Transpose() const {
+        Matrix result(cols_, rows_);
+        if constexpr (StorageLayout == Layout::kRowMajor) {
+            detail::BlockedTranspose(Data(), result.Data(), rows_, cols_);
+        } else {
+            // The column-major buffer read row-major is already the
+            // transpose, so the same kernel runs with the dims swapped.
+            detail::BlockedTranspose(Data(), result.Data(), cols_, rows_);
+        }
+        return result;
+    }
+
+    friend bool operator==(const Matrix& lhs, const Matrix& rhs) {
+        return lhs.rows_ == rhs.rows_ && lhs.cols_ == rhs.cols_ &&
+               lhs.data_ == rhs.data_;
+    }
+
+    friend std::ostream& operator<<(std::ostream& out, const Matrix& matrix) {
+        for (std::size_t i = 0; i < matrix.rows_; ++i) {
+            for (std::size_t j = 0; j < matrix.cols_; ++j) {
+                out << matrix(i, j) << (j + 1 == matrix.cols_ ? "" : " ");
+            }
+            out << '\n';
+        }
+        return out;
+    }
+
+private:
+    std::size_t Index(std::size_t i, std::size_t j) const {
+        if constexpr (StorageLayout == Layout::kRowMajor) {
+            return i * cols_ + j;
+        } else {
+            return i + j * rows_;
+        }
+    }
+
+    std::size_t rows_ = 0;
+    std::size_t cols_ = 0;
+    // NUMA-aware backing: large stores get policy-driven first-touch
+    // placement, small ones just come back page-aligned.
+    std::vector<T, NumaAllocator<T>> data_;
+};
+
+// A^T * B without materializing A^T: the transposition is folded into the
+// pack step of the blocked kernel, so A is only ever read in its row-major
+// layout. This is the entry point the normal-equations paths should use —
+// `a.Transpose() * b` costs a full extra read and write of A.
+template <typename T>
+Matrix<T> MultiplyAtB(const Matrix<T>& a, const Matrix<T>& b) {
+    assert(a.Rows() == b.Rows());
+    std::size_t m = a.Cols();
+    std::size_t n = b.Cols();
+    std::size_t k = a.Rows();
+    Matrix<T> result(m, n);
+    if (std::max({m, n, k}) < detail::kGemmDispatchThreshold) {
+        detail::NaiveMultiplyTransA(a.Data(), b.Data(), result.Data(), m, n,
+                                    k);
+    } else {
+        detail::BlockedMultiplyTransA(a.Data(), b.Data(), result.Data(), m,
+                                      n, k);
+    }
+    return result;
+}
+
+// A * B^T without materializing B^T; the transposed pack of the B panel
+// reads B along its rows.
+template <typename T>
+Matrix<T> MultiplyABt(const Matrix<T>& a, const Matrix<T>& b) {
+    assert(a.Cols() == b.Cols());
+    std::size_t m = a.Rows();
+    std::size_t n = b.Rows();
+    std::size_t k = a.Cols();
+    Matrix<T> result(m, n);
+    if (std::max({m, n, k}) < detail::kGemmDispatchThreshold) {
+        detail::NaiveMultiplyTransB(a.Data(), b.Data(), result.Data(), m, n,
+                                    k);
+    } else {
+        detail::BlockedMultiplyTransB(a.Data(), b.Data(), result.Data(), m,
+                                      n, k);
+    }
+    return result;
+}
+
+}  // namespace linalg
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+
+#include "expressions.h"
+#include "matrix.h"
+
+namespace linalg {
+
+// Non-owning window into dense row-major storage: a pointer plus dimensions
+// and a row stride. Views participate in lazy expressions and are accepted by
+// every kernel in algorithms/, so panel factorizations and trailing updates
+// run in place instead of round-tripping through extracted copies. The viewed
+// storage must outlive the view.
+template <typename T>
+class MatrixView : public MatrixExpression<MatrixView<T>> {
+public:
+    using ValueType = T;
+
+    MatrixView(T* data, std::size_t rows, std::size_t cols,
+               std::size_t stride)
+        : data_(data), rows_(rows), cols_(cols), stride_(stride) {
+        assert(stride >= cols);
+    }
+
+    MatrixView(Matrix<T>& matrix)
+        : MatrixView(matrix.Data(), matrix.Rows(), matrix.Cols(),
+                     matrix.Cols()) {}
+
+    std::size_t Rows() const {
+        return rows_;
+    }
+
+    std::size_t Cols() const {
+        return cols_;
+    }
+
+    std::size_t Stride() const {
+        return stride_;
+    }
+
+    T* Data() const {
+        return data_;
+    }
+
+    T& operator()(std::size_t i, std::size_t j) const {
+        assert(i < rows_ && j < cols_);
+        return data_[i * stride_ + j];
+    }
+
+    MatrixView Submatrix(std::size_t row_begin, std::size_t col_begin,
+                         std::size_t rows, std::size_t cols) const {
+        assert(row_begin + rows <= rows_ && col_begin + cols <= cols_);
+        return MatrixView(data_ + row_begin * stride_ + col_begin, rows, cols,
+                          stride_);
+    }
+
+private:
+    T* data_;
+    std::size_t rows_;
+    std::size_t cols_;
+    std::size_t stride_;
+};
+
+// Read-only counterpart of MatrixView, convertible from both Matrix and the
+// mutable view.
+template <typename T>
+class ConstMatrixView : public MatrixExpression<ConstMatrixView<T>> {
+public:
+    using ValueType = T;
+
+    ConstMatrixView(const T* data, std::size_t rows, std::size_t cols,
+                    std::size_t stride)
+        : data_(data), rows_(rows), cols_(cols), stride_(stride) {
+        assert(stride >= cols);
+    }
+
+    ConstMatrixView(const Matrix<T>& matrix)
+        : ConstMatrixView(matrix.Data(), matrix.Rows(), matrix.Cols(),
+                          matrix.Cols()) {}
+
+    ConstMatrixView(MatrixView<T> view)
+        : ConstMatrixView(view.Data(), view.Rows(), view.Cols(),
+                          view.Stride()) {}
+
+    std::size_t Rows() const {
+        return rows_;
+    }
+
+    std::size_t Cols() const {
+        return cols_;
+    }
+
+    std::size_t Stride() const {
+        return stride_;
+    }
+
+    const T* Data() const {
+        return data_;
+    }
+
+    const T& operator()(std::size_t i, std::size_t j) const {
+        assert(i < rows_ && j < cols_);
+        return data_[i * stride_ + j];
+    }
+
+    ConstMatrixView Submatrix(std::size_t row_begin, std::size_t col_begin,
+                              std::size_t rows, std::size_t cols) const {
+        assert(row_begin + rows <= rows_ && col_begin + cols <= cols_);
+        return ConstMatrixView(data_ + row_begin * stride_ + col_begin, rows,
+                               cols, stride_);
+    }
+
+private:
+    const T* data_;
+    std::size_t rows_;
+    std::size_t cols_;
+    std::size_t stride_;
+};
+
+}  // namespace linalg
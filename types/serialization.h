@@ -0,0 +1,230 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "matrix.h"
+#include "matrix_view.h"
+
+namespace linalg {
+
+namespace detail {
+
+// On-disk layout: this 64-byte header, then the raw row-major payload. The
+// header size doubles as the payload offset, so the element data of a
+// mapped file starts 64-byte aligned (mmap returns page-aligned bases) and
+// SIMD loads on a mapping need no peeling.
+struct BinaryMatrixHeader {
+    char magic[4];
+    std::uint32_t version;
+    std::uint32_t dtype;
+    std::uint32_t reserved;
+    std::uint64_t rows;
+    std::uint64_t cols;
+    std::uint64_t stride;  // row stride in elements; equals cols on disk
+    char padding[24];
+};
+
+static_assert(sizeof(BinaryMatrixHeader) == 64,
+              "header must pad the payload to 64-byte alignment");
+
+inline constexpr char kBinaryMagic[4] = {'L', 'A', 'B', 'M'};
+inline constexpr std::uint32_t kBinaryVersion = 1;
+
+template <typename T>
+struct BinaryDtype;
+
+template <>
+struct BinaryDtype<float> {
+    static constexpr std::uint32_t kCode = 1;
+};
+
+template <>
+struct BinaryDtype<double> {
+    static constexpr std::uint32_t kCode = 2;
+};
+
+template <typename T>
+bool ValidHeader(const BinaryMatrixHeader& header) {
+    return std::memcmp(header.magic, kBinaryMagic, sizeof(kBinaryMagic)) ==
+               0 &&
+           header.version == kBinaryVersion &&
+           header.dtype == BinaryDtype<T>::kCode &&
+           header.stride >= header.cols;
+}
+
+}  // namespace detail
+
+// Writes the view row by row (so strided sources, e.g. submatrix views,
+// serialize compacted) behind a 64-byte header with dims, dtype, and
+// stride. Returns false on I/O failure.
+template <typename T>
+bool SaveBinary(ConstMatrixView<T> matrix, const std::string& path) {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        return false;
+    }
+
+    detail::BinaryMatrixHeader header = {};
+    std::memcpy(header.magic, detail::kBinaryMagic,
+                sizeof(detail::kBinaryMagic));
+    header.version = detail::kBinaryVersion;
+    header.dtype = detail::BinaryDtype<T>::kCode;
+    header.rows = matrix.Rows();
+    header.cols = matrix.Cols();
+    header.stride = matrix.Cols();
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    for (std::size_t i = 0; i < matrix.Rows(); ++i) {
+        out.write(reinterpret_cast<const char*>(&matrix(i, 0)),
+                  static_cast<std::streamsize>(matrix.Cols() * sizeof(T)));
+    }
+    return static_cast<bool>(out);
+}
+
+// Reads a matrix saved by SaveBinary into fresh heap storage. Returns
+// std::nullopt if the file is missing, truncated, or carries the wrong
+// magic or dtype.
+template <typename T>
+std::optional<Matrix<T>> LoadBinary(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        return std::nullopt;
+    }
+
+    detail::BinaryMatrixHeader header;
+    in.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!in || !detail::ValidHeader<T>(header)) {
+        return std::nullopt;
+    }
+
+    Matrix<T> result(header.rows, header.cols);
+    for (std::uint64_t i = 0; i < header.rows; ++i) {
+        in.read(reinterpret_cast<char*>(&result(i, 0)),
+                static_cast<std::streamsize>(header.cols * sizeof(T)));
+        if (i + 1 < header.rows) {
+            in.seekg(static_cast<std::streamoff>(
+                         (header.stride - header.cols) * sizeof(T)),
+                     std::ios::cur);
+        }
+    }
+    if (!in) {
+        return std::nullopt;
+    }
+    return result;
+}
+
+// Zero-copy load: maps the file read-only and exposes the payload as a
+// ConstMatrixView over the mapping, so opening a multi-gigabyte factor
+// costs one mmap instead of reading it into heap storage — pages fault in
+// lazily as they are touched. The mapping lives as long as this object;
+// views obtained from it must not outlive it.
+template <typename T>
+class MappedMatrix {
+public:
+    MappedMatrix() = default;
+
+    // Factory instead of a throwing constructor: returns std::nullopt if
+    // the file cannot be opened, mapped, or fails header validation.
+    static std::optional<MappedMatrix> Open(const std::string& path) {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            return std::nullopt;
+        }
+        struct stat info;
+        if (::fstat(fd, &info) != 0 ||
+            static_cast<std::size_t>(info.st_size) <
+                sizeof(detail::BinaryMatrixHeader)) {
+            ::close(fd);
+            return std::nullopt;
+        }
+        std::size_t size = static_cast<std::size_t>(info.st_size);
+        void* base = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);  // the mapping keeps the file alive
+        if (base == MAP_FAILED) {
+            return std::nullopt;
+        }
+
+        MappedMatrix result;
+        result.base_ = base;
+        result.size_ = size;
+        const auto* header =
+            static_cast<const detail::BinaryMatrixHeader*>(base);
+        if (!detail::ValidHeader<T>(*header) ||
+            size < sizeof(*header) + (header->rows * header->stride) *
+                                         sizeof(T)) {
+            return std::nullopt;  // destructor unmaps
+        }
+        result.rows_ = header->rows;
+        result.cols_ = header->cols;
+        result.stride_ = header->stride;
+        return result;
+    }
+
+    MappedMatrix(MappedMatrix&& other) noexcept
+        : base_(std::exchange(other.base_, nullptr)),
+          size_(std::exchange(other.size_, 0)),
+          rows_(std::exchange(other.rows_, 0)),
+          cols_(std::exchange(other.cols_, 0)),
+          stride_(std::exchange(other.stride_, 0)) {}
+
+    MappedMatrix& operator=(MappedMatrix&& other) noexcept {
+        if (this != &other) {
+            Unmap();
+            base_ = std::exchange(other.base_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+            rows_ = std::exchange(other.rows_, 0);
+            cols_ = std::exchange(other.cols_, 0);
+            stride_ = std::exchange(other.stride_, 0);
+        }
+        return *this;
+    }
+
+    MappedMatrix(const MappedMatrix&) = delete;
+    MappedMatrix& operator=(const MappedMatrix&) = delete;
+
+    ~MappedMatrix() {
+        Unmap();
+    }
+
+    std::size_t Rows() const {
+        return rows_;
+    }
+
+    std::size_t Cols() const {
+        return cols_;
+    }
+
+    ConstMatrixView<T> View() const {
+        const T* data = reinterpret_cast<const T*>(
+            static_cast<const char*>(base_) +
+            sizeof(detail::BinaryMatrixHeader));
+        return ConstMatrixView<T>(data, rows_, cols_, stride_);
+    }
+
+private:
+    void Unmap() {
+        if (base_ != nullptr) {
+            ::munmap(base_, size_);
+            base_ = nullptr;
+        }
+    }
+
+    void* base_ = nullptr;
+    std::size_t size_ = 0;
+    std::size_t rows_ = 0;
+    std::size_t cols_ = 0;
+    std::size_t stride_ = 0;
+};
+
+}  // namespace linalg
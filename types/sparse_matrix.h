@@ -0,0 +1,168 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "../core/simd.h"
+#include "matrix.h"
+
+namespace linalg {
+
+// Compressed sparse row storage: row_offsets_[i]..row_offsets_[i + 1] index
+// the (column, value) pairs of row i, columns sorted ascending within each
+// row. Only the nonzeros are stored, so an n x n matrix with nnz entries
+// costs O(n + nnz) memory instead of O(n^2), and every product below walks
+// the nonzeros exactly once.
+template <typename T>
+class SparseMatrix {
+public:
+    struct Triplet {
+        std::size_t row;
+        std::size_t col;
+        T value;
+    };
+
+    SparseMatrix() = default;
+
+    // Builds CSR from an unordered triplet list; duplicates at the same
+    // position are summed, exact zeros after summing are dropped.
+    static SparseMatrix FromTriplets(std::size_t rows, std::size_t cols,
+                                     std::vector<Triplet> triplets) {
+        std::sort(triplets.begin(), triplets.end(),
+                  [](const Triplet& a, const Triplet& b) {
+                      return std::tie(a.row, a.col) < std::tie(b.row, b.col);
+                  });
+
+        SparseMatrix result;
+        result.rows_ = rows;
+        result.cols_ = cols;
+        result.row_offsets_.assign(rows + 1, 0);
+        for (std::size_t p = 0; p < triplets.size();) {
+            const Triplet& head = triplets[p];
+            assert(head.row < rows && head.col < cols);
+            T sum{};
+            while (p < triplets.size() && triplets[p].row == head.row &&
+                   triplets[p].col == head.col) {
+                sum += triplets[p].value;
+                ++p;
+            }
+            if (sum != T{}) {
+                result.col_indices_.push_back(head.col);
+                result.values_.push_back(sum);
+                ++result.row_offsets_[head.row + 1];
+            }
+        }
+        for (std::size_t i = 0; i < rows; ++i) {
+            result.row_offsets_[i + 1] += result.row_offsets_[i];
+        }
+        return result;
+    }
+
+    // Compresses a dense matrix, keeping entries with |a(i, j)| > tolerance.
+    static SparseMatrix FromDense(const Matrix<T>& a, T tolerance = T{}) {
+        SparseMatrix result;
+        result.rows_ = a.Rows();
+        result.cols_ = a.Cols();
+        result.row_offsets_.assign(result.rows_ + 1, 0);
+        for (std::size_t i = 0; i < result.rows_; ++i) {
+            for (std::size_t j = 0; j < result.cols_; ++j) {
+                T value = a(i, j);
+                if (value > tolerance || value < -tolerance) {
+                    result.col_indices_.push_back(j);
+                    result.values_.push_back(value);
+                }
+            }
+            result.row_offsets_[i + 1] = result.values_.size();
+        }
+        return result;
+    }
+
+    Matrix<T> ToDense() const {
+        Matrix<T> result(rows_, cols_);
+        for (std::size_t i = 0; i < rows_; ++i) {
+            for (std::size_t p = row_offsets_[i]; p < row_offsets_[i + 1];
+                 ++p) {
+                result(i, col_indices_[p]) = values_[p];
+            }
+        }
+        return result;
+    }
+
+    std::size_t Rows() const {
+        return rows_;
+    }
+
+    std::size_t Cols() const {
+        return cols_;
+    }
+
+    std::size_t NonZeros() const {
+        return values_.size();
+    }
+
+    const std::vector<std::size_t>& RowOffsets() const {
+        return row_offsets_;
+    }
+
+    const std::vector<std::size_t>& ColIndices() const {
+        return col_indices_;
+    }
+
+    const std::vector<T>& Values() const {
+        return values_;
+    }
+
+private:
+    std::size_t rows_ = 0;
+    std::size_t cols_ = 0;
+    std::vector<std::size_t> row_offsets_;
+    std::vector<std::size_t> col_indices_;
+    std::vector<T> values_;
+};
+
+// Sparse-dense product A * B: each nonzero a(i, j) contributes
+// a(i, j) * B(j, :) to row i of the result — a unit-stride axpy per
+// nonzero in row-major storage, so SpMV and multi-column GEMM share one
+// loop. O(nnz * k) for k right-hand-side columns.
+template <typename T>
+Matrix<T> operator*(const SparseMatrix<T>& a, const Matrix<T>& b) {
+    assert(a.Cols() == b.Rows());
+    std::size_t k = b.Cols();
+    Matrix<T> result(a.Rows(), k);
+    const auto& offsets = a.RowOffsets();
+    const auto& indices = a.ColIndices();
+    const auto& values = a.Values();
+    for (std::size_t i = 0; i < a.Rows(); ++i) {
+        T* out = &result(i, 0);
+        for (std::size_t p = offsets[i]; p < offsets[i + 1]; ++p) {
+            simd::Axpy(values[p], &b(indices[p], 0), out, k);
+        }
+    }
+    return result;
+}
+
+// A^T * B without forming the transpose: nonzero a(i, j) scatters
+// a(i, j) * B(i, :) into row j. Same cost as the forward product; this is
+// the adjoint apply the least-squares solvers need.
+template <typename T>
+Matrix<T> MultiplyAtB(const SparseMatrix<T>& a, const Matrix<T>& b) {
+    assert(a.Rows() == b.Rows());
+    std::size_t k = b.Cols();
+    Matrix<T> result(a.Cols(), k);
+    const auto& offsets = a.RowOffsets();
+    const auto& indices = a.ColIndices();
+    const auto& values = a.Values();
+    for (std::size_t i = 0; i < a.Rows(); ++i) {
+        const T* in = &b(i, 0);
+        for (std::size_t p = offsets[i]; p < offsets[i + 1]; ++p) {
+            simd::Axpy(values[p], in, &result(indices[p], 0), k);
+        }
+    }
+    return result;
+}
+
+}  // namespace linalg
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <utility>
+
+#include "matrix_view.h"
+#include "serialization.h"
+
+namespace linalg {
+
+// Panel iterator over a binary matrix file: the file is mapped, not read,
+// so only the panel currently being processed occupies resident memory —
+// the OS pages earlier panels out as later ones fault in. This is the input
+// side of the out-of-core drivers in algorithms/, which run over matrices
+// far larger than RAM one row panel at a time.
+template <typename T>
+class RowPanelReader {
+public:
+    static std::optional<RowPanelReader> Open(const std::string& path,
+                                              std::size_t panel_rows) {
+        assert(panel_rows > 0);
+        auto mapped = MappedMatrix<T>::Open(path);
+        if (!mapped.has_value()) {
+            return std::nullopt;
+        }
+        RowPanelReader reader;
+        reader.mapped_ = std::move(*mapped);
+        reader.panel_rows_ = panel_rows;
+        return reader;
+    }
+
+    std::size_t Rows() const {
+        return mapped_.Rows();
+    }
+
+    std::size_t Cols() const {
+        return mapped_.Cols();
+    }
+
+    std::size_t PanelCount() const {
+        return (mapped_.Rows() + panel_rows_ - 1) / panel_rows_;
+    }
+
+    // Zero-copy view of panel index; the last panel may be short.
+    ConstMatrixView<T> Panel(std::size_t index) const {
+        assert(index < PanelCount());
+        std::size_t row_begin = index * panel_rows_;
+        std::size_t rows =
+            std::min(panel_rows_, mapped_.Rows() - row_begin);
+        return mapped_.View().Submatrix(row_begin, 0, rows, Cols());
+    }
+
+private:
+    RowPanelReader() = default;
+
+    MappedMatrix<T> mapped_;
+    std::size_t panel_rows_ = 0;
+};
+
+// Streaming counterpart for output: panels are appended as they are
+// produced and the header is finalized on Close(), so a matrix can be
+// written without ever existing in memory as a whole. The column count is
+// fixed up front; the row count is whatever was appended.
+template <typename T>
+class RowPanelWriter {
+public:
+    RowPanelWriter(const std::string& path, std::size_t cols)
+        : out_(path, std::ios::binary | std::ios::trunc), cols_(cols) {
+        // Placeholder header; Close() seeks back and rewrites it with the
+        // final row count.
+        detail::BinaryMatrixHeader header = {};
+        out_.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    }
+
+    bool AppendPanel(ConstMatrixView<T> panel) {
+        assert(panel.Cols() == cols_);
+        for (std::size_t i = 0; i < panel.Rows(); ++i) {
+            out_.write(reinterpret_cast<const char*>(&panel(i, 0)),
+                       static_cast<std::streamsize>(cols_ * sizeof(T)));
+        }
+        rows_ += panel.Rows();
+        return static_cast<bool>(out_);
+    }
+
+    bool Close() {
+        detail::BinaryMatrixHeader header = {};
+        std::memcpy(header.magic, detail::kBinaryMagic,
+                    sizeof(detail::kBinaryMagic));
+        header.version = detail::kBinaryVersion;
+        header.dtype = detail::BinaryDtype<T>::kCode;
+        header.rows = rows_;
+        header.cols = cols_;
+        header.stride = cols_;
+        out_.seekp(0);
+        out_.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out_.flush();
+        return static_cast<bool>(out_);
+    }
+
+private:
+    std::ofstream out_;
+    std::size_t cols_;
+    std::size_t rows_ = 0;
+};
+
+}  // namespace linalg
@@ -0,0 +1,156 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <vector>
+
+#include "../core/simd.h"
+#include "matrix.h"
+
+namespace linalg {
+
+enum class TriangularKind {
+    kUpper,
+    kLower,
+};
+
+// Square triangular matrix with only the nonzero half stored, packed row by
+// row. Reads outside the triangle return zero, so the type drops into the
+// duck-typed kernels unchanged, while the dedicated solve and multiply
+// below skip the structural zeros entirely — half the storage and half the
+// flops of running the dense routines on a triangular operand.
+template <typename T>
+class TriangularMatrix {
+public:
+    TriangularMatrix() = default;
+
+    TriangularMatrix(std::size_t n, TriangularKind kind)
+        : n_(n), kind_(kind), data_(n * (n + 1) / 2, T{}) {}
+
+    // Packs the triangular half of a dense matrix; the other half is
+    // ignored, not checked.
+    static TriangularMatrix FromDense(const Matrix<T>& dense,
+                                      TriangularKind kind) {
+        assert(dense.Rows() == dense.Cols());
+        TriangularMatrix result(dense.Rows(), kind);
+        for (std::size_t i = 0; i < result.n_; ++i) {
+            std::size_t j_begin = kind == TriangularKind::kUpper ? i : 0;
+            std::size_t j_end =
+                kind == TriangularKind::kUpper ? result.n_ : i + 1;
+            for (std::size_t j = j_begin; j < j_end; ++j) {
+                result.At(i, j) = dense(i, j);
+            }
+        }
+        return result;
+    }
+
+    std::size_t Rows() const {
+        return n_;
+    }
+
+    std::size_t Cols() const {
+        return n_;
+    }
+
+    TriangularKind Kind() const {
+        return kind_;
+    }
+
+    // Value read: zero outside the stored triangle.
+    T operator()(std::size_t i, std::size_t j) const {
+        assert(i < n_ && j < n_);
+        if (Outside(i, j)) {
+            return T{};
+        }
+        return data_[Index(i, j)];
+    }
+
+    // Mutable access, valid only within the stored triangle.
+    T& At(std::size_t i, std::size_t j) {
+        assert(i < n_ && j < n_ && !Outside(i, j));
+        return data_[Index(i, j)];
+    }
+
+    Matrix<T> ToDense() const {
+        Matrix<T> result(n_, n_);
+        for (std::size_t i = 0; i < n_; ++i) {
+            for (std::size_t j = 0; j < n_; ++j) {
+                result(i, j) = (*this)(i, j);
+            }
+        }
+        return result;
+    }
+
+    // Multi-RHS substitution solve of T * X = B; back substitution for the
+    // upper kind, forward for the lower. Each row update runs over the
+    // packed row of the triangle and the matching rows of X with unit
+    // stride, touching only the stored entries.
+    Matrix<T> Solve(Matrix<T> rhs) const {
+        assert(rhs.Rows() == n_);
+        std::size_t width = rhs.Cols();
+        if (kind_ == TriangularKind::kUpper) {
+            for (std::size_t i = n_; i-- > 0;) {
+                const T* row = data_.data() + Index(i, i);
+                for (std::size_t p = i + 1; p < n_; ++p) {
+                    simd::Axpy(-row[p - i], &rhs(p, 0), &rhs(i, 0), width);
+                }
+                Scale(&rhs(i, 0), width, row[0]);
+            }
+        } else {
+            for (std::size_t i = 0; i < n_; ++i) {
+                const T* row = data_.data() + Index(i, 0);
+                for (std::size_t p = 0; p < i; ++p) {
+                    simd::Axpy(-row[p], &rhs(p, 0), &rhs(i, 0), width);
+                }
+                Scale(&rhs(i, 0), width, row[i]);
+            }
+        }
+        return rhs;
+    }
+
+    // C = T * B over the stored half only.
+    friend Matrix<T> operator*(const TriangularMatrix& lhs,
+                               const Matrix<T>& rhs) {
+        assert(lhs.n_ == rhs.Rows());
+        std::size_t width = rhs.Cols();
+        Matrix<T> result(lhs.n_, width);
+        for (std::size_t i = 0; i < lhs.n_; ++i) {
+            std::size_t j_begin =
+                lhs.kind_ == TriangularKind::kUpper ? i : 0;
+            std::size_t j_end =
+                lhs.kind_ == TriangularKind::kUpper ? lhs.n_ : i + 1;
+            const T* row = lhs.data_.data() + lhs.Index(i, j_begin);
+            for (std::size_t j = j_begin; j < j_end; ++j) {
+                simd::Axpy(row[j - j_begin], &rhs(j, 0), &result(i, 0),
+                           width);
+            }
+        }
+        return result;
+    }
+
+private:
+    bool Outside(std::size_t i, std::size_t j) const {
+        return kind_ == TriangularKind::kUpper ? j < i : j > i;
+    }
+
+    // Offset of (i, j) in the packed triangle; requires !Outside(i, j).
+    std::size_t Index(std::size_t i, std::size_t j) const {
+        if (kind_ == TriangularKind::kUpper) {
+            return i * n_ - i * (i - 1) / 2 + (j - i);
+        }
+        return i * (i + 1) / 2 + j;
+    }
+
+    static void Scale(T* row, std::size_t width, T pivot) {
+        assert(pivot != T{});
+        for (std::size_t j = 0; j < width; ++j) {
+            row[j] /= pivot;
+        }
+    }
+
+    std::size_t n_ = 0;
+    TriangularKind kind_ = TriangularKind::kUpper;
+    std::vector<T> data_;
+};
+
+}  // namespace linalg